@@ -0,0 +1,62 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "helpers/network_headers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// Compiled, not run, once per set of instruction sets: cmake/compare_weak_symbols.cmake checks that no inline function of the library,
+// emitted as a weak symbol, has the same name in two of the objects
+
+// Samples of 12 bits, packed two per three bytes
+struct samples
+{
+    std::array<uint16_t, 16U> values;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<samples>
+    {
+        using type = std::tuple<packed_array<12U, 16U>>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// The memcpy fast path, and the byte-shuffle kernels
+tcp_header decode_header (std::span<const uint8_t> bytes)
+{
+    return ldl::deserialize<tcp_header, std::endian::big> (bytes);
+}
+
+// The bulk byte-swap kernels
+std::array<uint32_t, 64U> decode_array (std::span<const uint8_t> bytes)
+{
+    return static_cast<std::array<uint32_t, 64U>> (ldl::deserialize<std::array<uint32_t, 64U>, std::endian::big> (bytes));
+}
+
+// The bit-unpacking kernels
+samples decode_samples (std::span<const uint8_t> bytes)
+{
+    return ldl::deserialize<samples, std::endian::big> (bytes);
+}
+
+void unpack_samples (std::span<const uint8_t> bytes, std::span<uint16_t> out)
+{
+    ldl::object_deserializer<const uint8_t, std::endian::little> deserializer{bytes};
+    deserializer.unpack_into<12U> (out);
+}
+
+// The bit-compaction kernels of the varint decoder
+size_t decode_varints (std::span<const uint8_t> bytes, std::span<uint64_t> out)
+{
+    return ldl::decode_varints (bytes, out).values;
+}
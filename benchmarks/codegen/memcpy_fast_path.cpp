@@ -0,0 +1,45 @@
+#include <cstddef>
+
+#include "helpers/network_headers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// Compiled, not run: the sizes of these functions are compared by cmake/compare_symbol_sizes.cmake
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+using tcp_rule = ldl::deserialization_rules::rule_t<tcp_header>;
+
+static_assert(ldl::concepts::memcpy_deserializable<tcp_header>);
+
+extern "C" tcp_header ldl_fast_path_big (const uint8_t * src)
+{
+    std::span<const uint8_t> bytes{src, sizeof(tcp_header)};
+    return ldl::deserialize<tcp_header, std::endian::big> (bytes);
+}
+
+extern "C" tcp_header ldl_field_by_field_big (const uint8_t * src)
+{
+    std::span<const uint8_t> bytes{src, sizeof(tcp_header)};
+    return ldl::construct_from_tuple<tcp_header, tcp_rule, std::endian::big> (bytes);
+}
+
+extern "C" tcp_header ldl_fast_path_little (const uint8_t * src)
+{
+    std::span<const uint8_t> bytes{src, sizeof(tcp_header)};
+    return ldl::deserialize<tcp_header, std::endian::little> (bytes);
+}
+
+extern "C" tcp_header ldl_field_by_field_little (const uint8_t * src)
+{
+    std::span<const uint8_t> bytes{src, sizeof(tcp_header)};
+    return ldl::construct_from_tuple<tcp_header, tcp_rule, std::endian::little> (bytes);
+}
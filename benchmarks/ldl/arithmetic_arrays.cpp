@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+template<size_t N> struct sample_block
+{
+    std::array<uint32_t, N> samples;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<size_t N> struct rule<sample_block<N>>
+    {
+        using type = std::tuple<std::array<uint32_t, N>>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Hand-written element-by-element conversion
+template<size_t N> static void BM_ElementLoop (benchmark::State & state)
+{
+    constexpr size_t blocks{(1U << 18) / (N * sizeof(uint32_t))};
+    const auto bytes{random_bytes (blocks * N * sizeof(uint32_t))};
+    std::vector<sample_block<N>> out(blocks);
+
+    for (auto _ : state) {
+        for (size_t block{0U}; block < blocks; ++block) {
+            const auto * src{bytes.data() + (block * N * sizeof(uint32_t))};
+            for (size_t i{0U}; i < N; ++i) {
+                out[block].samples[i] = ldl::reader::read<uint32_t, std::endian::big> (src + (i * sizeof(uint32_t)));
+            }
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+// std::array rule element
+template<size_t N> static void BM_RuleArray (benchmark::State & state)
+{
+    constexpr size_t blocks{(1U << 18) / (N * sizeof(uint32_t))};
+    const auto bytes{random_bytes (blocks * N * sizeof(uint32_t))};
+    std::vector<sample_block<N>> out(blocks);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.template deserialize_into<sample_block<N>> (out);
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+    state.SetLabel (ldl::bulk_reader_helpers::kernel_name);
+}
+
+BENCHMARK(BM_ElementLoop<4>);
+BENCHMARK(BM_RuleArray<4>);
+BENCHMARK(BM_ElementLoop<64>);
+BENCHMARK(BM_RuleArray<64>);
+BENCHMARK(BM_ElementLoop<4096>);
+BENCHMARK(BM_RuleArray<4096>);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// One deserialize<T>() call, with its own length check, per record
+template<typename T> static void BM_PerCallLoop (benchmark::State & state)
+{
+    const auto records{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (records * ldl::deserialization_length<T>())};
+    std::vector<T> out(records);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        for (auto & record : out) {
+            record = deserializer.template deserialize<T>();
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+// A single deserialize_into<T>() call for the whole run
+template<typename T> static void BM_DeserializeInto (benchmark::State & state)
+{
+    const auto records{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (records * ldl::deserialization_length<T>())};
+    std::vector<T> out(records);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.template deserialize_into<T> (out);
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+BENCHMARK(BM_PerCallLoop<ip_header>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_DeserializeInto<ip_header>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_PerCallLoop<tcp_header>)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_DeserializeInto<tcp_header>)->Arg(1 << 10)->Arg(1 << 16);
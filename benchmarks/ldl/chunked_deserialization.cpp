@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/chunked_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// TCP headers received back to back in 1460-byte segments, so that some of them straddle two segments
+constexpr size_t records{4096U};
+constexpr size_t record_length{ldl::deserialization_length<tcp_header>()};
+constexpr size_t segment_length{1460U};
+
+namespace
+{
+    std::vector<std::span<const uint8_t>> segments (std::span<const uint8_t> bytes)
+    {
+        std::vector<std::span<const uint8_t>> chunks;
+        for (size_t offset{0U}; offset < bytes.size(); offset += segment_length) {
+            chunks.push_back (bytes.subspan (offset, std::min (segment_length, bytes.size() - offset)));
+        }
+
+        return chunks;
+    }
+}
+
+// The segments are copied into a contiguous buffer, which is then deserialized
+static void BM_CopyThenDecode (benchmark::State & state)
+{
+    const auto bytes{random_bytes (records * record_length)};
+    const auto chunks{segments (bytes)};
+    std::vector<uint8_t> contiguous(bytes.size());
+
+    for (auto _ : state) {
+        auto out{contiguous.begin()};
+        for (const auto chunk : chunks) {
+            out = std::ranges::copy (chunk, out).out;
+        }
+        ldl::network_packet_deserializer deserializer{std::span{contiguous}};
+        for (size_t i{0U}; i < records; ++i) {
+            const auto header{deserializer.deserialize<tcp_header>()};
+            benchmark::DoNotOptimize (header);
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+}
+
+// The segments are deserialized in place, stitching only the records that straddle two of them
+static void BM_ChunkedDecode (benchmark::State & state)
+{
+    const auto bytes{random_bytes (records * record_length)};
+    const auto chunks{segments (bytes)};
+
+    for (auto _ : state) {
+        ldl::chunked_deserializer<const uint8_t, std::endian::big> deserializer{std::span{chunks}};
+        for (size_t i{0U}; i < records; ++i) {
+            const auto header{deserializer.deserialize<tcp_header>()};
+            benchmark::DoNotOptimize (header);
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+}
+
+BENCHMARK(BM_CopyThenDecode);
+BENCHMARK(BM_ChunkedDecode);
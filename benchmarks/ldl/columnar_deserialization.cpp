@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Decode whole objects, then project the two addresses
+static void BM_ObjectsThenProject (benchmark::State & state)
+{
+    const auto records{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (records * ldl::deserialization_length<ip_header>())};
+    std::vector<ip_header> headers(records);
+    std::vector<uint32_t> src_ip(records);
+    std::vector<uint32_t> dest_ip(records);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.deserialize_into<ip_header> (headers);
+        for (size_t i{0U}; i < records; ++i) {
+            src_ip[i] = headers[i].src_ip;
+            dest_ip[i] = headers[i].dest_ip;
+        }
+        benchmark::DoNotOptimize (src_ip.data());
+        benchmark::DoNotOptimize (dest_ip.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+}
+
+// Decode only the two address columns
+static void BM_Columns (benchmark::State & state)
+{
+    const auto records{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (records * ldl::deserialization_length<ip_header>())};
+    std::vector<uint32_t> src_ip(records);
+    std::vector<uint32_t> dest_ip(records);
+    ldl::columns_t<ip_header> columns{};
+    std::get<8> (columns) = src_ip;
+    std::get<9> (columns) = dest_ip;
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.deserialize_columns<ip_header> (records, columns);
+        benchmark::DoNotOptimize (src_ip.data());
+        benchmark::DoNotOptimize (dest_ip.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+    state.SetLabel (ldl::bulk_reader_helpers::kernel_name);
+}
+
+// Endian conversion of a contiguous column, element by element
+template<typename T> static void BM_ScalarRead (benchmark::State & state)
+{
+    const auto count{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (count * sizeof(T))};
+    std::vector<T> values(count);
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < count; ++i) {
+            values[i] = ldl::reader::read<T, std::endian::big> (bytes.data() + (i * sizeof(T)));
+        }
+        benchmark::DoNotOptimize (values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+// Endian conversion of a contiguous column with the bulk kernel
+template<typename T> static void BM_BulkRead (benchmark::State & state)
+{
+    const auto count{static_cast<size_t> (state.range (0))};
+    const auto bytes{random_bytes (count * sizeof(T))};
+    std::vector<T> values(count);
+
+    for (auto _ : state) {
+        ldl::bulk_reader::read<T, std::endian::big> (bytes.data(), values.data(), count);
+        benchmark::DoNotOptimize (values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+    state.SetLabel (ldl::bulk_reader_helpers::kernel_name);
+}
+
+BENCHMARK(BM_ObjectsThenProject)->Arg(1 << 16);
+BENCHMARK(BM_Columns)->Arg(1 << 16);
+BENCHMARK(BM_ScalarRead<uint16_t>)->Arg(1 << 14);
+BENCHMARK(BM_BulkRead<uint16_t>)->Arg(1 << 14);
+BENCHMARK(BM_ScalarRead<uint32_t>)->Arg(1 << 14);
+BENCHMARK(BM_BulkRead<uint32_t>)->Arg(1 << 14);
+BENCHMARK(BM_ScalarRead<uint64_t>)->Arg(1 << 14);
+BENCHMARK(BM_BulkRead<uint64_t>)->Arg(1 << 14);
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// Wide record of N members, each decoded from a field of 1, 2, 4, or 8 bytes
+template<size_t N> struct wide_record
+{
+    std::array<uint64_t, N> fields;
+};
+
+template<size_t I> using wide_field_t = std::tuple_element_t<I % 4U, std::tuple<uint8_t, uint16_t, uint32_t, uint64_t>>;
+
+template<typename Is> struct wide_rule;
+template<size_t... Is> struct wide_rule<std::index_sequence<Is...>>
+{
+    using type = std::tuple<wide_field_t<Is>...>;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<size_t N> struct rule<wide_record<N>>
+    {
+        using type = wide_rule<std::make_index_sequence<N>>::type;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// The previous decoding scheme: every field is read at the front of the span, which is then advanced past it
+template<typename T, std::endian E, size_t... Idx> T sequential_construct (std::span<const uint8_t> & packet, std::index_sequence<Idx...>)
+{
+    using rule = ldl::deserialization_rules::rule_t<T>;
+    return T{ldl::deserialize<std::tuple_element_t<Idx, rule>, E> (packet)...};
+}
+
+constexpr size_t buffer_length{1U << 18};
+
+template<size_t N> static void BM_SequentialSpan (benchmark::State & state)
+{
+    using record = wide_record<N>;
+    constexpr auto record_length{ldl::deserialization_length<record>()};
+    constexpr auto records{buffer_length / record_length};
+    const auto bytes{random_bytes (records * record_length)};
+    std::vector<record> out(records);
+
+    for (auto _ : state) {
+        std::span<const uint8_t> packet{bytes};
+        for (auto & value : out) {
+            value = sequential_construct<record, std::endian::big> (packet, std::make_index_sequence<N>());
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+template<size_t N> static void BM_ConstantOffset (benchmark::State & state)
+{
+    using record = wide_record<N>;
+    constexpr auto record_length{ldl::deserialization_length<record>()};
+    constexpr auto records{buffer_length / record_length};
+    const auto bytes{random_bytes (records * record_length)};
+    std::vector<record> out(records);
+
+    for (auto _ : state) {
+        std::span<const uint8_t> packet{bytes};
+        for (auto & value : out) {
+            value = ldl::deserialize<record, std::endian::big> (packet);
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+BENCHMARK(BM_SequentialSpan<10>);
+BENCHMARK(BM_ConstantOffset<10>);
+BENCHMARK(BM_SequentialSpan<50>);
+BENCHMARK(BM_ConstantOffset<50>);
+BENCHMARK(BM_SequentialSpan<200>);
+BENCHMARK(BM_ConstantOffset<200>);
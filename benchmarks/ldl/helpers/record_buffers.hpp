@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+// Returns "size" pseudo-random bytes; the fixed seed keeps runs comparable.
+inline std::vector<uint8_t> random_bytes (size_t size)
+{
+    std::mt19937 generator{0x1D1U};
+    std::uniform_int_distribution<unsigned int> distribution{0U, 0xFFU};
+
+    std::vector<uint8_t> bytes(size);
+    for (auto & byte : bytes) {
+        byte = static_cast<uint8_t> (distribution (generator));
+    }
+
+    return bytes;
+}
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/incremental_parser.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// IP and TCP headers received from a stream socket in pieces of the given length
+constexpr size_t messages{1024U};
+constexpr size_t message_length{ldl::deserialization_length<ip_header>() + ldl::deserialization_length<tcp_header>()};
+
+// The pieces are appended to a buffer, and the headers are deserialized once the buffer holds all their bytes
+static void BM_BufferThenDecode (benchmark::State & state)
+{
+    const auto bytes{random_bytes (messages * message_length)};
+    const auto piece_length{static_cast<size_t> (state.range (0))};
+    std::vector<uint8_t> pending;
+    pending.reserve (message_length + piece_length);
+
+    for (auto _ : state) {
+        pending.clear();
+        for (size_t offset{0U}; offset < bytes.size(); offset += piece_length) {
+            const auto piece{std::span{bytes}.subspan (offset, std::min (piece_length, bytes.size() - offset))};
+            pending.insert (pending.end(), piece.begin(), piece.end());
+            while (pending.size() >= message_length) {
+                ldl::network_packet_deserializer deserializer{std::span{pending}};
+                const auto headers{deserializer.deserialize<ip_header, tcp_header>()};
+                benchmark::DoNotOptimize (headers);
+                pending.erase (pending.begin(), pending.begin() + message_length);
+            }
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (messages));
+}
+
+// The pieces are fed to an incremental parser
+static void BM_IncrementalParser (benchmark::State & state)
+{
+    const auto bytes{random_bytes (messages * message_length)};
+    const auto piece_length{static_cast<size_t> (state.range (0))};
+    ldl::network_packet_parser<ip_header, tcp_header> parser;
+
+    for (auto _ : state) {
+        for (size_t offset{0U}; offset < bytes.size(); offset += piece_length) {
+            auto piece{std::span{bytes}.subspan (offset, std::min (piece_length, bytes.size() - offset))};
+            while (!piece.empty()) {
+                piece = piece.subspan (parser.feed (piece));
+                if (parser.done()) {
+                    benchmark::DoNotOptimize (parser.get<0>());
+                    benchmark::DoNotOptimize (parser.get<1>());
+                    parser.reset();
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (messages));
+}
+
+BENCHMARK(BM_BufferThenDecode)->Arg (7)->Arg (536)->Arg (1460);
+BENCHMARK(BM_IncrementalParser)->Arg (7)->Arg (536)->Arg (1460);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Packets of "length" bytes; a tcp_header needs 20
+constexpr size_t packets{1024U};
+
+static std::vector<uint8_t> packet_bytes (size_t length)
+{
+    return random_bytes (packets * length);
+}
+
+// deserialize, catching the std::length_error thrown for truncated packets
+static void BM_Throwing (benchmark::State & state)
+{
+    const auto length{static_cast<size_t> (state.range (0))};
+    const auto bytes{packet_bytes (length)};
+    size_t malformed{0U};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * length, length)};
+            try {
+                benchmark::DoNotOptimize (deserializer.deserialize<tcp_header>());
+            }
+            catch (const std::length_error &) {
+                ++malformed;
+            }
+        }
+    }
+    benchmark::DoNotOptimize (malformed);
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// try_deserialize, testing the returned result
+static void BM_NonThrowing (benchmark::State & state)
+{
+    const auto length{static_cast<size_t> (state.range (0))};
+    const auto bytes{packet_bytes (length)};
+    size_t malformed{0U};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * length, length)};
+            const auto header{deserializer.try_deserialize<tcp_header>()};
+            if (header.has_value()) {
+                benchmark::DoNotOptimize (*header);
+            }
+            else {
+                ++malformed;
+            }
+        }
+    }
+    benchmark::DoNotOptimize (malformed);
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// Truncated packets of 12 bytes, and well-formed packets of 20 bytes
+BENCHMARK(BM_Throwing)->Arg(12)->Arg(20);
+BENCHMARK(BM_NonThrowing)->Arg(12)->Arg(20);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+constexpr size_t records{1U << 14};
+
+// Field-by-field decoding through construct_from_tuple
+template<typename T, std::endian E> static void BM_FieldByField (benchmark::State & state)
+{
+    const auto bytes{random_bytes (records * sizeof(T))};
+    std::vector<T> out(records);
+
+    for (auto _ : state) {
+        std::span<const uint8_t> packet{bytes};
+        for (auto & record : out) {
+            ::new (static_cast<void *> (&record)) T(ldl::construct_from_tuple<T, ldl::deserialization_rules::rule_t<T>, E> (packet));
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+}
+
+// Decoding through deserialize, which takes the memcpy fast path
+template<typename T, std::endian E> static void BM_MemcpyFastPath (benchmark::State & state)
+{
+    static_assert(ldl::concepts::memcpy_deserializable<T>);
+    const auto bytes{random_bytes (records * sizeof(T))};
+    std::vector<T> out(records);
+
+    for (auto _ : state) {
+        std::span<const uint8_t> packet{bytes};
+        for (auto & record : out) {
+            ::new (static_cast<void *> (&record)) T(ldl::deserialize<T, E> (packet));
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (records));
+    state.SetLabel (ldl::bulk_reader_helpers::kernel_name);
+}
+
+BENCHMARK(BM_FieldByField<tcp_header, std::endian::big>);
+BENCHMARK(BM_MemcpyFastPath<tcp_header, std::endian::big>);
+BENCHMARK(BM_FieldByField<tcp_header, std::endian::little>);
+BENCHMARK(BM_MemcpyFastPath<tcp_header, std::endian::little>);
+BENCHMARK(BM_FieldByField<ip_header, std::endian::big>);
+BENCHMARK(BM_MemcpyFastPath<ip_header, std::endian::big>);
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Packets made of an Ethernet, an IPv4, and a TCP header
+constexpr size_t packets{1024U};
+constexpr size_t packet_length{ldl::deserialization_length<eth_header>() + ldl::deserialization_length<ip_header>() +
+                               ldl::deserialization_length<tcp_header>()};
+
+// One deserialize call, and one length check, per header
+static void BM_PerHeader (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            benchmark::DoNotOptimize (deserializer.deserialize<eth_header>());
+            benchmark::DoNotOptimize (deserializer.deserialize<ip_header>());
+            benchmark::DoNotOptimize (deserializer.deserialize<tcp_header>());
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// A single deserialize call, and length check, for the whole header stack
+static void BM_HeaderStack (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            benchmark::DoNotOptimize (deserializer.deserialize<eth_header, ip_header, tcp_header>());
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+BENCHMARK(BM_PerHeader);
+BENCHMARK(BM_HeaderStack);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "ldl/object_deserializer.hpp"
+
+#include "helpers/record_buffers.hpp"
+
+
+namespace ldl = little_deserialization_library;
+
+// Samples of a telemetry frame, packed back to back in network byte order
+constexpr size_t samples{65536U};
+
+// The usual loop: the bytes that hold every value are gathered at its bit offset, then shifted and masked
+template<size_t Bits> static void BM_HandWritten (benchmark::State & state)
+{
+    const auto bytes{random_bytes (ldl::bit_unpacker::packed_length<Bits> (samples) + 4U)};
+    std::vector<uint32_t> out(samples);
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < samples; ++i) {
+            const auto offset{i * Bits};
+            const auto first{offset / 8U};
+            const auto word{(uint32_t{bytes[first]} << 24U) | (uint32_t{bytes[first + 1U]} << 16U) | (uint32_t{bytes[first + 2U]} << 8U) |
+                            uint32_t{bytes[first + 3U]}};
+            out[i] = (word << (offset % 8U)) >> (32U - Bits);
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (samples));
+}
+
+template<size_t Bits> static void BM_UnpackInto (benchmark::State & state)
+{
+    const auto bytes{random_bytes (ldl::bit_unpacker::packed_length<Bits> (samples))};
+    std::vector<uint32_t> out(samples);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.template unpack_into<Bits> (std::span{out});
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (samples));
+    state.SetLabel (ldl::bit_unpacker_helpers::kernel_name);
+}
+
+// Frames of 64 samples decoded through their rule, into std::array members
+struct frame
+{
+    uint16_t                  sequence;
+    std::array<uint16_t, 64U> samples;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<frame>
+    {
+        using type = std::tuple<uint16_t, packed_array<12U, 64U>>;
+    };
+}
+
+static void BM_PackedArrayRule (benchmark::State & state)
+{
+    constexpr auto frames{samples / 64U};
+    const auto bytes{random_bytes (frames * ldl::deserialization_length<frame>())};
+    std::vector<frame> out(frames);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span{bytes}};
+        deserializer.deserialize_into<frame> (std::span{out});
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (samples));
+    state.SetLabel (ldl::bit_unpacker_helpers::kernel_name);
+}
+
+BENCHMARK_TEMPLATE(BM_HandWritten, 10);
+BENCHMARK_TEMPLATE(BM_UnpackInto, 10);
+BENCHMARK_TEMPLATE(BM_HandWritten, 12);
+BENCHMARK_TEMPLATE(BM_UnpackInto, 12);
+BENCHMARK_TEMPLATE(BM_HandWritten, 20);
+BENCHMARK_TEMPLATE(BM_UnpackInto, 20);
+BENCHMARK(BM_PackedArrayRule);
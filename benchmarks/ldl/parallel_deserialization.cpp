@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/parallel_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Back-to-back TCP headers, far more than the caches hold
+constexpr size_t packets{1U << 20U};
+
+namespace
+{
+    const std::vector<uint8_t> & capture (void)
+    {
+        static const auto bytes{random_bytes (packets * ldl::deserialization_length<tcp_header>())};
+        return bytes;
+    }
+
+    double decode_seconds (std::vector<tcp_header> & headers, size_t threads)
+    {
+        const auto start{std::chrono::steady_clock::now()};
+        ldl::parallel_deserialize<tcp_header, std::endian::big> (std::span{capture()}, std::span{headers}, threads);
+        return std::chrono::duration<double>{std::chrono::steady_clock::now() - start}.count();
+    }
+
+    // The best of a few single-threaded runs, against which parallel efficiency is computed
+    double single_thread_seconds (void)
+    {
+        static const auto seconds{[] {
+            std::vector<tcp_header> headers(packets);
+            auto best{decode_seconds (headers, 1U)};
+            for (int i{0}; i < 9; ++i) {
+                best = std::min (best, decode_seconds (headers, 1U));
+            }
+            return best;
+        } ()};
+        return seconds;
+    }
+}
+
+// Records are decoded on 1 to N threads; efficiency is the speedup over one thread, divided by the number of threads
+static void BM_ParallelDeserialize (benchmark::State & state)
+{
+    const auto threads{static_cast<size_t> (state.range (0))};
+    std::vector<tcp_header> headers(packets);
+    const auto baseline{single_thread_seconds()};
+
+    double seconds{0.0};
+    for (auto _ : state) {
+        seconds += decode_seconds (headers, threads);
+        benchmark::DoNotOptimize (headers.data());
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+    state.counters["efficiency"] = baseline / (seconds / static_cast<double> (state.iterations())) / static_cast<double> (threads);
+}
+
+BENCHMARK(BM_ParallelDeserialize)->RangeMultiplier (2)->Range (1, std::max (std::thread::hardware_concurrency(), 1U))->UseRealTime()->Unit (benchmark::kMillisecond);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "ldl/mapped_file_source.hpp"
+#include "ldl/pcap_reader.hpp"
+
+
+namespace ldl = little_deserialization_library;
+
+// A capture of Ethernet frames between 60 and 1514 bytes long, written in little endian
+constexpr uint64_t capture_size{2ULL << 30U};
+
+namespace
+{
+    // The capture is generated on first use, and removed at exit
+    class capture_file
+    {
+    public:
+        capture_file (void) : path_{std::filesystem::temp_directory_path() / "ldl_pcap_reading_benchmark.pcap"}
+        {
+            std::ofstream file{path_, std::ios::binary};
+            const auto write{[&file] (uint32_t value) { file.write (reinterpret_cast<const char *> (&value), sizeof(value)); }};
+            write (0xA1B2C3D4U);
+            write (0x00040002U);
+            write (0U);
+            write (0U);
+            write (65535U);
+            write (1U);
+
+            std::mt19937 generator{0x1D1U};
+            std::uniform_int_distribution<uint32_t> length{60U, 1514U};
+            std::vector<char> frame(1514U, 0x5A);
+            for (uint64_t written{24U}; written < capture_size;) {
+                const auto captured_length{length (generator)};
+                write (static_cast<uint32_t> (written / 1000U));
+                write (0U);
+                write (captured_length);
+                write (captured_length);
+                file.write (frame.data(), captured_length);
+                written += 16U + captured_length;
+            }
+        }
+        ~capture_file() { std::filesystem::remove (path_); }
+
+        const std::filesystem::path & path (void) const noexcept { return path_; }
+
+    private:
+        std::filesystem::path path_;
+    };
+
+    const std::filesystem::path & capture_path (void)
+    {
+        static const capture_file capture;
+        return capture.path();
+    }
+}
+
+// Every record is read with fread into a buffer, then its Ethertype is inspected
+static void BM_Fread (benchmark::State & state)
+{
+    const auto & path{capture_path()};
+    std::vector<uint8_t> frame(65535U);
+    std::vector<char> stream_buffer(1U << 20U);
+
+    for (auto _ : state) {
+        const auto file{std::fopen (path.c_str(), "rb")};
+        std::setvbuf (file, stream_buffer.data(), _IOFBF, stream_buffer.size());
+        std::array<uint8_t, 24U> file_header;
+        std::fread (file_header.data(), 1U, file_header.size(), file);
+
+        uint64_t ethertypes{0U};
+        std::array<uint8_t, 16U> record_header;
+        while (std::fread (record_header.data(), 1U, record_header.size(), file) == record_header.size()) {
+            ldl::object_deserializer<uint8_t, std::endian::little> deserializer{std::span{record_header}};
+            const auto header{deserializer.deserialize<ldl::pcap::record_header>()};
+            if (std::fread (frame.data(), 1U, header.captured_length, file) != header.captured_length) {
+                break;
+            }
+            ethertypes += (uint32_t{frame[12]} << 8U) | frame[13];
+        }
+        std::fclose (file);
+        benchmark::DoNotOptimize (ethertypes);
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (std::filesystem::file_size (path)));
+}
+
+// The file is mapped, and the Ethertype of every record is inspected in place
+static void BM_MappedFile (benchmark::State & state)
+{
+    const auto & path{capture_path()};
+
+    for (auto _ : state) {
+        const ldl::mapped_file_source file{path};
+        const ldl::pcap::reader reader{file.bytes()};
+
+        uint64_t ethertypes{0U};
+        for (const auto & record : reader) {
+            ethertypes += (uint32_t{record.data[12]} << 8U) | record.data[13];
+        }
+        benchmark::DoNotOptimize (ethertypes);
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (std::filesystem::file_size (path)));
+}
+
+BENCHMARK(BM_Fread)->Unit (benchmark::kMillisecond);
+BENCHMARK(BM_MappedFile)->Unit (benchmark::kMillisecond);
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+
+#include "ldl/prefetching_deserializer.hpp"
+
+
+struct eth_ip_tcp_headers
+{
+    eth_header eth;
+    ip_header ip;
+    tcp_header tcp;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<eth_ip_tcp_headers>
+    {
+        using type = std::tuple<eth_header, ip_header, tcp_header>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// A pool of 2 KiB packet buffers, larger than the last-level cache, of which bursts of 32 packets are decoded in random order
+constexpr size_t buffer_size{2048U};
+constexpr size_t pool_size{1ULL << 30U};
+constexpr size_t burst_size{32U};
+
+namespace
+{
+    struct packet_pool
+    {
+        std::vector<uint8_t> bytes;
+        std::vector<std::span<const uint8_t>> packets;
+
+        packet_pool (void) : bytes(pool_size)
+        {
+            for (size_t offset{0U}; offset < pool_size; offset += buffer_size) {
+                for (size_t i{0U}; i < 64U; ++i) {
+                    bytes[offset + i] = static_cast<uint8_t> (offset + i);
+                }
+                packets.emplace_back (std::span{bytes}.subspan (offset, 64U));
+            }
+            std::ranges::shuffle (packets, std::mt19937{0x1D1U});
+        }
+    };
+
+    const packet_pool & pool (void)
+    {
+        static const packet_pool packets;
+        return packets;
+    }
+}
+
+// Every burst is decoded with the given prefetch distance; 0 disables prefetching
+static void BM_DecodeBursts (benchmark::State & state)
+{
+    const auto & packets{pool().packets};
+    const auto distance{static_cast<size_t> (state.range (0))};
+    std::vector<eth_ip_tcp_headers> headers(burst_size);
+
+    size_t burst{0U};
+    for (auto _ : state) {
+        const std::span<const std::span<const uint8_t>> bursts{packets.data() + (burst * burst_size), burst_size};
+        ldl::deserialize_batch<eth_ip_tcp_headers, std::endian::big> (bursts, std::span{headers}, distance);
+        benchmark::DoNotOptimize (headers.data());
+        burst = (burst + 1U) % (packets.size() / burst_size);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (burst_size));
+}
+
+BENCHMARK(BM_DecodeBursts)->Arg (0)->Arg (2)->Arg (4)->Arg (8)->Arg (16);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// The 5-tuple of a TCP/IPv4 flow
+struct flow_key
+{
+    uint8_t  protocol;
+    uint32_t src_ip;
+    uint32_t dest_ip;
+    uint16_t src_port;
+    uint16_t dest_port;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<flow_key>
+    {
+        using type = std::tuple<skip<9U>, uint8_t, skip<2U>, uint32_t, uint32_t, uint16_t, uint16_t, skip<16U>>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Packets made of an IPv4 and a TCP header
+constexpr size_t packets{1024U};
+constexpr size_t packet_length{ldl::deserialization_length<flow_key>()};
+
+// Both headers are decoded, then the flow key is built from them
+static void BM_FullHeaders (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+    std::vector<flow_key> keys(packets);
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            const auto [ip_packet, tcp_packet] = deserializer.deserialize<ip_header, tcp_header>();
+            keys[i] = flow_key{ip_packet.protocol, ip_packet.src_ip, ip_packet.dest_ip, tcp_packet.src_port, tcp_packet.dest_port};
+        }
+        benchmark::DoNotOptimize (keys.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// Only the fields of the flow key are decoded, through a projection rule
+static void BM_Projection (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+    std::vector<flow_key> keys(packets);
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            keys[i] = deserializer.deserialize<flow_key>();
+        }
+        benchmark::DoNotOptimize (keys.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+BENCHMARK(BM_FullHeaders);
+BENCHMARK(BM_Projection);
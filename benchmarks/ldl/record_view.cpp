@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// IPv4 headers, of which only the protocol and the destination address are inspected
+constexpr size_t packets{1024U};
+constexpr size_t packet_length{ldl::deserialization_length<ip_header>()};
+
+// The whole header is decoded, then two fields are read
+static void BM_DecodeHeader (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            const auto header{deserializer.deserialize<ip_header>()};
+            benchmark::DoNotOptimize (header.protocol);
+            benchmark::DoNotOptimize (header.dest_ip);
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// Only the two fields are decoded, through a record_view
+static void BM_ViewFields (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * packet_length)};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < packets; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * packet_length, packet_length)};
+            const auto header{deserializer.view<ip_header>()};
+            benchmark::DoNotOptimize (header.get<6>());
+            benchmark::DoNotOptimize (header.get<9>());
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+BENCHMARK(BM_DecodeHeader);
+BENCHMARK(BM_ViewFields);
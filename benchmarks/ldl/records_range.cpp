@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/records.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Back-to-back IPv4 headers, of which every record, or one in 16, is inspected
+constexpr size_t packets{4096U};
+constexpr size_t sample_stride{16U};
+
+// All the records are deserialized to a vector, which is then scanned
+static void BM_DeserializeThenScan (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * ldl::deserialization_length<ip_header>())};
+    const auto stride{static_cast<size_t> (state.range (0))};
+    std::vector<ip_header> headers(packets);
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        deserializer.deserialize_into (std::span{headers});
+        uint32_t destinations{0U};
+        for (size_t i{0U}; i < packets; i += stride) {
+            destinations += headers[i].dest_ip;
+        }
+        benchmark::DoNotOptimize (destinations);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets / stride));
+}
+
+// The records are decoded on access, through ldl::records
+static void BM_RecordsRange (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * ldl::deserialization_length<ip_header>())};
+    const auto stride{static_cast<size_t> (state.range (0))};
+
+    for (auto _ : state) {
+        uint32_t destinations{0U};
+        const auto headers{ldl::records<ip_header, std::endian::big> (std::span{bytes})};
+        for (size_t i{0U}; i < headers.size(); i += stride) {
+            destinations += headers[i].dest_ip;
+        }
+        benchmark::DoNotOptimize (destinations);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets / stride));
+}
+
+BENCHMARK(BM_DeserializeThenScan)->Arg (1)->Arg (sample_stride);
+BENCHMARK(BM_RecordsRange)->Arg (1)->Arg (sample_stride);
@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// Counts the allocations of every decoding strategy, which all draw their vectors from a memory resource
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+    size_t allocations{0U};
+
+private:
+    void * do_allocate (size_t size, size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate (size, alignment);
+    }
+    void do_deallocate (void * p, size_t size, size_t alignment) override { std::pmr::new_delete_resource()->deallocate (p, size, alignment); }
+    bool do_is_equal (const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+};
+
+struct route_entry
+{
+    uint32_t prefix;
+    uint8_t  prefix_length;
+    uint32_t next_hop;
+    uint16_t metric;
+};
+
+struct route_update
+{
+    uint8_t  version;
+    uint16_t count;
+    std::pmr::vector<route_entry> entries;
+    uint16_t checksum;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<route_entry>
+    {
+        using type = std::tuple<uint32_t, uint8_t, uint32_t, uint16_t>;
+    };
+
+    template<> struct rule<route_update>
+    {
+        using type = std::tuple<uint8_t, uint16_t, repeated<1U, route_entry>, uint16_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Back-to-back routing updates of 32 entries each
+constexpr size_t messages{256U};
+constexpr size_t entries_per_message{32U};
+constexpr size_t message_length{ldl::deserialization_length<route_update>() + (entries_per_message * ldl::deserialization_length<route_entry>())};
+
+namespace
+{
+    std::vector<uint8_t> make_updates (void)
+    {
+        auto bytes{random_bytes (messages * message_length)};
+        for (size_t i{0U}; i < messages; ++i) {
+            bytes[(i * message_length) + 1U] = 0U;
+            bytes[(i * message_length) + 2U] = static_cast<uint8_t> (entries_per_message);
+        }
+        return bytes;
+    }
+
+    void report (benchmark::State & state, size_t allocations)
+    {
+        state.counters["allocs_per_message"] = benchmark::Counter (static_cast<double> (allocations) / static_cast<double> (state.iterations() * messages));
+        state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (messages));
+    }
+}
+
+// The count is read first, and the entries are pushed into a vector one by one
+static void BM_HandWrittenLoop (benchmark::State & state)
+{
+    const auto bytes{make_updates()};
+    counting_resource counting;
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        for (size_t i{0U}; i < messages; ++i) {
+            deserializer.skip (1U);
+            const auto count{deserializer.deserialize<uint16_t>()};
+            std::pmr::vector<route_entry> entries{&counting};
+            for (size_t j{0U}; j < count; ++j) {
+                entries.push_back (deserializer.deserialize<route_entry>());
+            }
+            benchmark::DoNotOptimize (entries.data());
+            benchmark::DoNotOptimize (deserializer.deserialize<uint16_t>());
+        }
+    }
+    report (state, counting.allocations);
+}
+
+// repeated, with the default memory resource
+static void BM_RepeatedDefaultResource (benchmark::State & state)
+{
+    const auto bytes{make_updates()};
+    counting_resource counting;
+    const auto previous{std::pmr::set_default_resource (&counting)};
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        for (size_t i{0U}; i < messages; ++i) {
+            const auto update{deserializer.deserialize<route_update>()};
+            benchmark::DoNotOptimize (update.entries.data());
+        }
+    }
+    report (state, counting.allocations);
+    std::pmr::set_default_resource (previous);
+}
+
+// repeated, with a monotonic arena on the stack, released after every message
+static void BM_RepeatedMonotonicArena (benchmark::State & state)
+{
+    const auto bytes{make_updates()};
+    alignas(std::max_align_t) std::array<std::byte, 4096U> arena_buffer;
+    counting_resource upstream;
+    std::pmr::monotonic_buffer_resource arena{arena_buffer.data(), arena_buffer.size(), &upstream};
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        for (size_t i{0U}; i < messages; ++i) {
+            {
+                const auto update{deserializer.deserialize<route_update> (arena)};
+                benchmark::DoNotOptimize (update.entries.data());
+            }
+            arena.release();
+        }
+    }
+    report (state, upstream.allocations);
+}
+
+BENCHMARK(BM_HandWrittenLoop);
+BENCHMARK(BM_RepeatedDefaultResource);
+BENCHMARK(BM_RepeatedMonotonicArena);
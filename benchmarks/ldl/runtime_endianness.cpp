@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/runtime_endian_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Back-to-back IPv4 headers, whose endianness is passed in at run time
+constexpr size_t packets{1024U};
+
+namespace
+{
+    template<std::endian E> uint32_t decode_all (ldl::object_deserializer<const uint8_t, E> & deserializer)
+    {
+        uint32_t destinations{0U};
+        for (size_t i{0U}; i < packets; ++i) {
+            destinations += deserializer.template deserialize_noexcept<ip_header>().dest_ip;
+        }
+        return destinations;
+    }
+}
+
+// Endianness fixed at compile time
+static void BM_CompileTimeEndianness (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * ldl::deserialization_length<ip_header>())};
+
+    for (auto _ : state) {
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        benchmark::DoNotOptimize (decode_all (deserializer));
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// Endianness selected at every call
+static void BM_PerCallDispatch (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * ldl::deserialization_length<ip_header>())};
+    auto endianness{std::endian::big};
+    benchmark::DoNotOptimize (endianness);
+
+    for (auto _ : state) {
+        ldl::runtime_endian_deserializer deserializer{std::span<const uint8_t>{bytes}, endianness};
+        uint32_t destinations{0U};
+        for (size_t i{0U}; i < packets; ++i) {
+            destinations += deserializer.deserialize_noexcept<ip_header>().dest_ip;
+        }
+        benchmark::DoNotOptimize (destinations);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+// Endianness selected once per buffer, through visit()
+static void BM_PerBufferDispatch (benchmark::State & state)
+{
+    const auto bytes{random_bytes (packets * ldl::deserialization_length<ip_header>())};
+    auto endianness{std::endian::big};
+    benchmark::DoNotOptimize (endianness);
+
+    for (auto _ : state) {
+        ldl::runtime_endian_deserializer deserializer{std::span<const uint8_t>{bytes}, endianness};
+        benchmark::DoNotOptimize (deserializer.visit ([] (auto & inner) { return decode_all (inner); }));
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (packets));
+}
+
+BENCHMARK(BM_CompileTimeEndianness);
+BENCHMARK(BM_PerCallDispatch);
+BENCHMARK(BM_PerBufferDispatch);
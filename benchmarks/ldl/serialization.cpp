@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+#include <arpa/inet.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_serializer.hpp"
+
+
+// The fields of an IPv4 header in separate members, which do not match the layout on the wire
+struct ip_fields
+{
+    uint8_t  version;
+    uint8_t  ihl;
+    uint8_t  dscp_ecn;
+    uint16_t total_length;
+    uint16_t identification;
+    uint8_t  flags;
+    uint16_t frag_offset;
+    uint8_t  ttl;
+    uint8_t  protocol;
+    uint16_t checksum;
+    uint32_t src_ip;
+    uint32_t dest_ip;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<ip_fields>
+    {
+        using type = std::tuple<bits<uint8_t, 4U, 4U>, uint8_t, uint16_t, uint16_t, bits<uint16_t, 3U, 13U>, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// Back-to-back IPv4 headers
+constexpr size_t packets{1024U};
+
+namespace
+{
+    template<typename T> std::vector<T> decoded_headers (void)
+    {
+        const auto bytes{random_bytes (packets * ldl::deserialization_length<T>())};
+        std::vector<T> headers(packets);
+        ldl::network_packet_deserializer deserializer{std::span<const uint8_t>{bytes}};
+        deserializer.deserialize_into<T> (std::span{headers});
+        return headers;
+    }
+
+    void write_by_hand (const ip_header & ip, uint8_t * dst) noexcept
+    {
+        const uint16_t total_length{htons (ip.total_length)};
+        const uint16_t identification{htons (ip.identification)};
+        const uint16_t flags_frag_offset{htons (ip.flags_frag_offset)};
+        const uint16_t checksum{htons (ip.checksum)};
+        const uint32_t src_ip{htonl (ip.src_ip)};
+        const uint32_t dest_ip{htonl (ip.dest_ip)};
+
+        dst[0] = ip.ihl_version;
+        dst[1] = ip.dscp_ecn;
+        std::memcpy (dst + 2, &total_length, 2U);
+        std::memcpy (dst + 4, &identification, 2U);
+        std::memcpy (dst + 6, &flags_frag_offset, 2U);
+        dst[8] = ip.ttl;
+        dst[9] = ip.protocol;
+        std::memcpy (dst + 10, &checksum, 2U);
+        std::memcpy (dst + 12, &src_ip, 4U);
+        std::memcpy (dst + 16, &dest_ip, 4U);
+    }
+
+    void write_by_hand (const ip_fields & ip, uint8_t * dst) noexcept
+    {
+        const uint16_t total_length{htons (ip.total_length)};
+        const uint16_t identification{htons (ip.identification)};
+        const uint16_t flags_frag_offset{htons (static_cast<uint16_t> ((ip.flags << 13U) | (ip.frag_offset & 0x1FFFU)))};
+        const uint16_t checksum{htons (ip.checksum)};
+        const uint32_t src_ip{htonl (ip.src_ip)};
+        const uint32_t dest_ip{htonl (ip.dest_ip)};
+
+        dst[0] = static_cast<uint8_t> ((ip.version << 4U) | (ip.ihl & 0x0FU));
+        dst[1] = ip.dscp_ecn;
+        std::memcpy (dst + 2, &total_length, 2U);
+        std::memcpy (dst + 4, &identification, 2U);
+        std::memcpy (dst + 6, &flags_frag_offset, 2U);
+        dst[8] = ip.ttl;
+        dst[9] = ip.protocol;
+        std::memcpy (dst + 10, &checksum, 2U);
+        std::memcpy (dst + 12, &src_ip, 4U);
+        std::memcpy (dst + 16, &dest_ip, 4U);
+    }
+}
+
+// Hand-written htons/htonl code
+template<typename T> static void BM_HandWritten (benchmark::State & state)
+{
+    const auto headers{decoded_headers<T>()};
+    std::vector<uint8_t> bytes(packets * ldl::deserialization_length<T>());
+
+    for (auto _ : state) {
+        auto dst{bytes.data()};
+        for (const auto & header : headers) {
+            write_by_hand (header, dst);
+            dst += ldl::deserialization_length<T>();
+        }
+        benchmark::DoNotOptimize (bytes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+template<typename T> static void BM_ObjectSerializer (benchmark::State & state)
+{
+    const auto headers{decoded_headers<T>()};
+    std::vector<uint8_t> bytes(packets * ldl::deserialization_length<T>());
+
+    for (auto _ : state) {
+        ldl::network_packet_serializer serializer{std::span{bytes}};
+        for (const auto & header : headers) {
+            serializer.serialize (header);
+        }
+        benchmark::DoNotOptimize (bytes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+}
+
+// Members in wire order: one memcpy and an in-place swap per header
+BENCHMARK(BM_HandWritten<ip_header>);
+BENCHMARK(BM_ObjectSerializer<ip_header>);
+// Bit fields packed into their words
+BENCHMARK(BM_HandWritten<ip_fields>);
+BENCHMARK(BM_ObjectSerializer<ip_fields>);
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "ldl/tlv_range.hpp"
+
+
+struct mss_option
+{
+    uint16_t mss;
+};
+
+struct timestamps_option
+{
+    uint32_t value;
+    uint32_t echo_reply;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<mss_option>
+    {
+        using type = std::tuple<uint16_t>;
+    };
+
+    template<> struct rule<timestamps_option>
+    {
+        using type = std::tuple<uint32_t, uint32_t>;
+    };
+}
+
+namespace ldl = little_deserialization_library;
+
+// The options of 1024 TCP SYN segments, 20 bytes each: MSS, SACK Permitted, Timestamps
+constexpr size_t segments{1024U};
+constexpr size_t options_length{20U};
+
+namespace
+{
+    std::vector<uint8_t> make_options (void)
+    {
+        const uint8_t syn_options[options_length] = {0x02, 0x04, 0x05, 0xB4, 0x04, 0x02, 0x08, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,
+                                                     0x01, 0x03, 0x03, 0x07};
+        std::vector<uint8_t> bytes;
+        for (size_t i{0U}; i < segments; ++i) {
+            bytes.insert (bytes.end(), std::begin (syn_options), std::end (syn_options));
+            bytes[bytes.size() - 10U] = static_cast<uint8_t> (i);
+        }
+        return bytes;
+    }
+}
+
+// The option loop written by hand
+static void BM_HandWritten (benchmark::State & state)
+{
+    const auto bytes{make_options()};
+
+    for (auto _ : state) {
+        uint32_t sum{0U};
+        for (size_t s{0U}; s < segments; ++s) {
+            const auto options{bytes.data() + (s * options_length)};
+            for (size_t i{0U}; i < options_length;) {
+                const auto kind{options[i]};
+                if (kind == 0U) {
+                    break;
+                }
+                if (kind == 1U) {
+                    ++i;
+                    continue;
+                }
+                if (((i + 1U) >= options_length) || (options[i + 1U] < 2U) || ((i + options[i + 1U]) > options_length)) {
+                    break;
+                }
+                if ((kind == 2U) && (options[i + 1U] == 4U)) {
+                    sum += static_cast<uint32_t> ((options[i + 2U] << 8U) | options[i + 3U]);
+                }
+                else if ((kind == 8U) && (options[i + 1U] == 10U)) {
+                    sum += (uint32_t{options[i + 2U]} << 24U) | (uint32_t{options[i + 3U]} << 16U) | (uint32_t{options[i + 4U]} << 8U) | options[i + 5U];
+                }
+                i += options[i + 1U];
+            }
+        }
+        benchmark::DoNotOptimize (sum);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (segments));
+}
+
+// Iteration, and decoding of the known options through their rules
+static void BM_TlvRange (benchmark::State & state)
+{
+    const auto bytes{make_options()};
+
+    for (auto _ : state) {
+        uint32_t sum{0U};
+        for (size_t s{0U}; s < segments; ++s) {
+            const auto options{ldl::tlv<uint8_t, uint8_t, std::endian::big, ldl::tlv_layouts::tcp_options> (
+                std::span<const uint8_t>{bytes}.subspan (s * options_length, options_length))};
+            for (const auto & option : options) {
+                const auto decoded{option.decode<ldl::on<2, mss_option>, ldl::on<8, timestamps_option>>()};
+                if (const auto mss{std::get_if<mss_option> (&decoded)}; mss != nullptr) {
+                    sum += mss->mss;
+                }
+                else if (const auto timestamps{std::get_if<timestamps_option> (&decoded)}; timestamps != nullptr) {
+                    sum += timestamps->value;
+                }
+            }
+        }
+        benchmark::DoNotOptimize (sum);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (segments));
+}
+
+// Iteration alone, without decoding the values
+static void BM_TlvIterateOnly (benchmark::State & state)
+{
+    const auto bytes{make_options()};
+
+    for (auto _ : state) {
+        uint32_t sum{0U};
+        for (size_t s{0U}; s < segments; ++s) {
+            const auto options{ldl::tlv<uint8_t, uint8_t, std::endian::big, ldl::tlv_layouts::tcp_options> (
+                std::span<const uint8_t>{bytes}.subspan (s * options_length, options_length))};
+            for (const auto & option : options) {
+                sum += option.type + static_cast<uint32_t> (option.value.size());
+            }
+        }
+        benchmark::DoNotOptimize (sum);
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (segments));
+}
+
+BENCHMARK(BM_HandWritten);
+BENCHMARK(BM_TlvRange);
+BENCHMARK(BM_TlvIterateOnly);
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <variant>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/record_buffers.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace ldl = little_deserialization_library;
+
+using ipv4_case = ldl::on<0x0800, ip_header>;
+using ipv6_case = ldl::on<0x86DD, ipv6_header>;
+using arp_case = ldl::on<0x0806, arp_header>;
+using l3_header = ldl::variant_of<ipv4_case, ipv6_case, arp_case>;
+
+// An Ethernet frame followed by the header selected by its ethertype
+struct eth_frame
+{
+    std::array<uint8_t, 6U> dest_mac;
+    std::array<uint8_t, 6U> src_mac;
+    uint16_t ethertype;
+    l3_header l3;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<ipv6_header>
+    {
+        using type = std::tuple<uint32_t, uint16_t, uint8_t, uint8_t, std::array<uint8_t, 16U>, std::array<uint8_t, 16U>>;
+    };
+
+    template<> struct rule<arp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, std::array<uint8_t, 6U>, uint32_t, std::array<uint8_t, 6U>, uint32_t>;
+    };
+
+    template<> struct rule<eth_frame>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t, variant_on<2U, ipv4_case, ipv6_case, arp_case>>;
+    };
+}
+
+// Frames of 64 bytes, whose ethertype is drawn among IPv4, IPv6, ARP, and an unknown protocol, in random order
+constexpr size_t frames{1024U};
+constexpr size_t frame_length{64U};
+
+static std::vector<uint8_t> mixed_frames (void)
+{
+    constexpr uint16_t ethertypes[] = {0x0800U, 0x86DDU, 0x0806U, 0x88CCU};
+
+    auto bytes{random_bytes (frames * frame_length)};
+    std::mt19937 generator{0xE7U};
+    std::uniform_int_distribution<size_t> distribution{0U, std::size (ethertypes) - 1U};
+    for (size_t i{0U}; i < frames; ++i) {
+        const auto ethertype{ethertypes[distribution (generator)]};
+        bytes[(i * frame_length) + 12U] = static_cast<uint8_t> (ethertype >> 8);
+        bytes[(i * frame_length) + 13U] = static_cast<uint8_t> (ethertype & 0xFFU);
+    }
+
+    return bytes;
+}
+
+// A hand-written chain of comparisons on the ethertype
+static void BM_IfChain (benchmark::State & state)
+{
+    const auto bytes{mixed_frames()};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < frames; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * frame_length, frame_length)};
+            deserializer.skip (12U);
+            const auto ethertype{deserializer.deserialize<uint16_t>()};
+            l3_header l3;
+            if (ethertype == ipv4_case::key) {
+                l3 = deserializer.deserialize<ip_header>();
+            }
+            else if (ethertype == ipv6_case::key) {
+                l3 = deserializer.deserialize<ipv6_header>();
+            }
+            else if (ethertype == arp_case::key) {
+                l3 = deserializer.deserialize<arp_header>();
+            }
+            benchmark::DoNotOptimize (l3);
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (frames));
+}
+
+// deserialize_on, dispatching on the ethertype through the perfect hash and the table of decoders
+static void BM_DeserializeOn (benchmark::State & state)
+{
+    const auto bytes{mixed_frames()};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < frames; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * frame_length, frame_length)};
+            deserializer.skip (12U);
+            const auto ethertype{deserializer.deserialize<uint16_t>()};
+            benchmark::DoNotOptimize (deserializer.deserialize_on<ipv4_case, ipv6_case, arp_case> (ethertype));
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (frames));
+}
+
+// The whole frame, through a rule with a variant_on element
+static void BM_RuleElement (benchmark::State & state)
+{
+    const auto bytes{mixed_frames()};
+
+    for (auto _ : state) {
+        for (size_t i{0U}; i < frames; ++i) {
+            ldl::network_packet_deserializer deserializer{std::span{bytes}.subspan (i * frame_length, frame_length)};
+            benchmark::DoNotOptimize (deserializer.deserialize<eth_frame>());
+        }
+    }
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (frames));
+}
+
+BENCHMARK(BM_IfChain);
+BENCHMARK(BM_DeserializeOn);
+BENCHMARK(BM_RuleElement);
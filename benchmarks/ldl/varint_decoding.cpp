@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace ldl = little_deserialization_library;
+
+constexpr size_t values{16384U};
+
+namespace
+{
+    // A stream of varints that all take "length" bytes, or from 1 to 5 bytes at random when length is 0
+    std::vector<uint8_t> make_varints (size_t length)
+    {
+        std::mt19937_64 generator{length};
+        std::vector<uint8_t> bytes;
+        for (size_t i{0U}; i < values; ++i) {
+            const auto bytes_per_value{(length == 0U) ? ((generator() % 5U) + 1U) : length};
+            const auto low{(bytes_per_value == 1U) ? uint64_t{0U} : (uint64_t{1U} << (7U * (bytes_per_value - 1U)))};
+            auto value{low + (generator() % ((uint64_t{1U} << (7U * bytes_per_value)) - low))};
+            for (; value >= 0x80U; value >>= 7U) {
+                bytes.push_back (static_cast<uint8_t> (value | 0x80U));
+            }
+            bytes.push_back (static_cast<uint8_t> (value));
+        }
+        return bytes;
+    }
+}
+
+// The usual loop over the bytes of every varint
+static void BM_ByteAtATime (benchmark::State & state)
+{
+    const auto bytes{make_varints (static_cast<size_t> (state.range (0)))};
+    std::vector<uint64_t> out(values);
+
+    for (auto _ : state) {
+        size_t read{0U};
+        for (size_t i{0U}; (i < values) && (read < bytes.size()); ++i) {
+            uint64_t value{0U};
+            for (uint32_t shift{0U}; (read < bytes.size()) && (shift < 64U); shift += 7U) {
+                const auto byte{bytes[read++]};
+                value |= uint64_t{byte & 0x7FU} << shift;
+                if ((byte & 0x80U) == 0U) {
+                    break;
+                }
+            }
+            out[i] = value;
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (values));
+}
+
+// One varint element at a time, through the deserializer
+static void BM_DeserializeVarint (benchmark::State & state)
+{
+    const auto bytes{make_varints (static_cast<size_t> (state.range (0)))};
+    std::vector<uint64_t> out(values);
+
+    for (auto _ : state) {
+        std::span<const uint8_t> unread{bytes};
+        for (auto & value : out) {
+            value = ldl::deserialize<ldl::varint<uint64_t>, std::endian::little> (unread);
+        }
+        benchmark::DoNotOptimize (out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (values));
+}
+
+// The bulk kernel
+static void BM_DecodeVarints (benchmark::State & state)
+{
+    const auto bytes{make_varints (static_cast<size_t> (state.range (0)))};
+    std::vector<uint64_t> out(values);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize (ldl::decode_varints (std::span{bytes}, std::span{out}));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed (state.iterations() * static_cast<int64_t> (bytes.size()));
+    state.SetItemsProcessed (state.iterations() * static_cast<int64_t> (values));
+    state.SetLabel (ldl::varint_helpers::kernel_name);
+}
+
+// Bytes per value: 1, 2, 5, and a mix of 1 to 5
+BENCHMARK(BM_ByteAtATime)->Arg(1)->Arg(2)->Arg(5)->Arg(0);
+BENCHMARK(BM_DeserializeVarint)->Arg(1)->Arg(2)->Arg(5)->Arg(0);
+BENCHMARK(BM_DecodeVarints)->Arg(1)->Arg(2)->Arg(5)->Arg(0);
@@ -0,0 +1,35 @@
+# compare_symbol_sizes.cmake
+#
+# SPDX-License-Identifier: GNU GENERAL PUBLIC LICENSE Version 3 (GNU GPL-3.0)
+#
+# Script mode (cmake -P): fails unless the code of symbol FAST in OBJECT is smaller than the code of symbol REFERENCE,
+# or not larger when STRICT is OFF.
+# Variables: NM, OBJECT, FAST, REFERENCE, STRICT.
+
+function(get_symbol_size symbols symbol variable_name)
+    string(REGEX MATCH "[0-9a-fA-F]+ ([0-9a-fA-F]+) [A-Za-z] ${symbol}\n" match "${symbols}")
+    if(NOT match)
+        message(FATAL_ERROR "symbol ${symbol} not found")
+    endif()
+    math(EXPR size "0x${CMAKE_MATCH_1}")
+    set(${variable_name} ${size} PARENT_SCOPE)
+endfunction()
+
+execute_process(
+    COMMAND ${NM} --print-size --defined-only ${OBJECT}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${OBJECT}")
+endif()
+
+get_symbol_size("${symbols}" ${FAST} fast_size)
+get_symbol_size("${symbols}" ${REFERENCE} reference_size)
+message(STATUS "${FAST}: ${fast_size} bytes; ${REFERENCE}: ${reference_size} bytes")
+
+if(STRICT AND NOT fast_size LESS reference_size)
+    message(FATAL_ERROR "${FAST} is not smaller than ${REFERENCE}")
+elseif(fast_size GREATER reference_size)
+    message(FATAL_ERROR "${FAST} is larger than ${REFERENCE}")
+endif()
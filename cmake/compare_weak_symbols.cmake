@@ -0,0 +1,42 @@
+# compare_weak_symbols.cmake
+#
+# SPDX-License-Identifier: GNU GENERAL PUBLIC LICENSE Version 3 (GNU GPL-3.0)
+#
+# Script mode (cmake -P): fails if two of OBJECTS define a weak symbol of the library with the same name, i.e. if the linker could
+# keep the definition of an inline function built for one set of instruction sets in place of another.
+# Variables: NM, OBJECTS (a list separated by "|").
+
+string(REPLACE "|" ";" objects "${OBJECTS}")
+
+set(seen "")
+foreach(object ${objects})
+    execute_process(
+        COMMAND ${NM} --defined-only ${object}
+        OUTPUT_VARIABLE symbols
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${NM} failed on ${object}")
+    endif()
+
+    string(REGEX MATCHALL "[0-9a-fA-F]+ [WV] [^\n]*little_deserialization_library[^\n]*" weak_symbols "${symbols}")
+    if(NOT weak_symbols)
+        message(FATAL_ERROR "no weak symbol of the library found in ${object}")
+    endif()
+
+    set(names "")
+    foreach(weak_symbol ${weak_symbols})
+        string(REGEX REPLACE "^[0-9a-fA-F]+ [WV] " "" name "${weak_symbol}")
+        list(APPEND names "${name}")
+    endforeach()
+    list(LENGTH names count)
+    message(STATUS "${object}: ${count} weak symbols of the library")
+
+    foreach(name ${names})
+        list(FIND seen "${name}" index)
+        if(NOT index EQUAL -1)
+            message(FATAL_ERROR "${name} is defined by more than one object")
+        endif()
+    endforeach()
+    list(APPEND seen ${names})
+endforeach()
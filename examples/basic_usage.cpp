@@ -56,9 +56,7 @@ int main()
     namespace ldl = little_deserialization_library;
     auto packet{std::span{network_bytes}};
     ldl::network_packet_deserializer deserializer{packet};
-    auto ether_frame = deserializer.deserialize<eth_header>();
-    auto ip_packet = deserializer.deserialize<ip_header>();
-    auto tcp_packet = deserializer.deserialize<tcp_header>();
+    auto [ether_frame, ip_packet, tcp_packet] = deserializer.deserialize<eth_header, ip_header, tcp_header>();
 
     std::cout << std::format ("Eth src: {} - Eth dest: {} - Eth type: {}",
                               format_mac_address (ether_frame.src_mac), format_mac_address (ether_frame.dest_mac), ether_frame.ethertype) << "\n";
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <format>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    // Whether an object of type T holds no view into the bytes it is deserialized from
+    template<typename T> consteval bool holds_no_views (void)
+    {
+        if constexpr (concepts::is_static_extent_byte_span<T> || concepts::is_bounded_byte_array<T> || concepts::dynamic_element<T>) {
+            return false;
+        }
+        else if constexpr (concepts::ruled<T>) {
+            return [] <size_t... Idx> (std::index_sequence<Idx...>) {
+                return (true && ... && holds_no_views<std::tuple_element_t<Idx, deserialization_rules::rule_t<T>>>());
+            } (std::make_index_sequence<std::tuple_size_v<deserialization_rules::rule_t<T>>>());
+        }
+        else {
+            return true;
+        }
+    }
+
+    namespace concepts
+    {
+        /// <summary>
+        /// Requires that objects of type T have a length known at compile time, and hold no view into the bytes they are deserialized from:
+        /// neither T nor its deserialization rule contain std::span, built-in byte arrays, length_prefixed, sized_by, or variant_on elements.
+        /// Such objects can be deserialized from a copy of their bytes.
+        /// </summary>
+        template<typename T> concept self_contained = fixed_length<T> && holds_no_views<T>();
+    }
+
+    /// <summary>
+    /// Deserializes objects from a sequence of chunks, e.g. the segments of a reassembled TCP stream or the two halves of a ring buffer.
+    /// Objects that lie within one chunk are deserialized in place; objects that cross a chunk boundary are first gathered in a buffer on the stack.
+    /// The chunks, and the sequence that holds them, must outlive the deserializer.
+    /// </summary>
+    template<concepts::byte_like B, std::endian E> class chunked_deserializer
+    {
+    public:
+        constexpr explicit chunked_deserializer (std::span<const std::span<B>> chunks) noexcept
+            : chunks_{chunks}, available_{std::accumulate (chunks.begin(), chunks.end(), size_t{0U}, [] (size_t sum, std::span<B> chunk) { return sum + chunk.size(); })}
+        { advance (0U); }
+
+        /// <summary>
+        /// Constructs an object of type T with data in the chunks, possibly using a user-defined deserialization rule.
+        /// Throws a std::length_error if the number of bytes available in the chunks is not enough to deserialize the object.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <returns>An instance of an object of type T, constructed from data read from the chunks</returns>
+        template<concepts::self_contained T> T deserialize (void);
+        /// <summary>
+        /// Constructs an object of type T with data in the chunks, possibly using a user-defined deserialization rule.
+        /// Skips length checks. The behavior is undefined if the chunks do not hold enough data to deserialize the object.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <returns>An instance of an object of type T, constructed from data read from the chunks</returns>
+        template<concepts::self_contained T> T deserialize_noexcept (void) noexcept;
+        /// <summary>
+        /// Constructs an object of type T with data in the chunks, possibly using a user-defined deserialization rule.
+        /// Does not throw nor allocate: if the chunks do not hold enough data, returns error::not_enough_bytes and leaves the position unchanged.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <returns>An instance of an object of type T, constructed from data read from the chunks, or the error that prevented it</returns>
+        template<concepts::self_contained T> result<T> try_deserialize (void) noexcept;
+        /// <summary>
+        /// Advances the position in the chunks by the specified number of bytes.
+        /// </summary>
+        /// <param name="bytes">The number of bytes to skip</param>
+        void skip (size_t bytes);
+        /// <summary>
+        /// Advances the position in the chunks by the deserialization length of type T.
+        /// Equivalent to skip (deserialization_length<T>());
+        /// </summary>
+        /// <typeparam name="T">The type of object to compute the deserialization length</typeparam>
+        template<concepts::fixed_length T> void skip (void);
+
+        /// <summary>
+        /// Returns the number of unread bytes in the chunks.
+        /// </summary>
+        constexpr size_t available (void) const noexcept { return available_; }
+
+        /// <summary>
+        /// Computes and returns the number of bytes that would be read from the chunks to deserialize an object of type T.
+        /// </summary>
+        /// <typeparam name="T">The type of the object</typeparam>
+        /// <returns>The number of bytes that will be read to deserialize an object of type T</returns>
+        template<typename T> static consteval auto deserialization_length (void)
+        { return little_deserialization_library::deserialization_length<T>(); }
+
+
+    private:
+        // Moves the position forward by "bytes", then past any exhausted or empty chunk
+        constexpr void advance (size_t bytes) noexcept
+        {
+            available_ -= bytes;
+            for (; chunk_ < chunks_.size(); ++chunk_, offset_ = 0U) {
+                const auto left{chunks_[chunk_].size() - offset_};
+                if (bytes < left) {
+                    offset_ += bytes;
+                    return;
+                }
+                bytes -= left;
+            }
+        }
+
+        // Copies the next "bytes" bytes to dst, across chunk boundaries, and moves the position past them
+        void gather (std::remove_cv_t<B> * dst, size_t bytes) noexcept
+        {
+            while (bytes > 0U) {
+                const auto chunk{chunks_[chunk_].subspan (offset_)};
+                const auto count{std::min (bytes, chunk.size())};
+                std::copy_n (chunk.data(), count, dst);
+                dst += count;
+                bytes -= count;
+                advance (count);
+            }
+        }
+
+        std::span<const std::span<B>> chunks_;
+        size_t chunk_{0U};
+        size_t offset_{0U};
+        size_t available_;
+    };
+
+
+    template<concepts::byte_like B, std::endian E> template<concepts::self_contained T> inline T chunked_deserializer<B, E>::deserialize (void)
+    {
+        if (static constexpr auto minimum_buffer_length{chunked_deserializer::deserialization_length<T>()}; available_ < minimum_buffer_length) {
+            throw std::length_error{std::format ("impossible to deserialize the requested object; Required bytes: {}; available bytes: {}",
+                                                  minimum_buffer_length, available_)};
+        }
+
+        return deserialize_noexcept<T>();
+    }
+
+    template<concepts::byte_like B, std::endian E> template<concepts::self_contained T> inline T chunked_deserializer<B, E>::deserialize_noexcept (void) noexcept
+    {
+        constexpr auto length{chunked_deserializer::deserialization_length<T>()};
+
+        if (chunk_ < chunks_.size()) {
+            const auto chunk{chunks_[chunk_]};
+            const auto data{chunk.data() + offset_};
+            if ((chunk.size() - offset_) > length) {
+                // The object lies strictly inside the current chunk: no chunk boundary to move past
+                offset_ += length;
+                available_ -= length;
+
+                return little_deserialization_library::deserialize_at<T, E> (data);
+            }
+            if ((chunk.size() - offset_) == length) {
+                advance (length);
+
+                return little_deserialization_library::deserialize_at<T, E> (data);
+            }
+        }
+
+        std::array<std::remove_cv_t<B>, length> scratch;
+        gather (scratch.data(), length);
+
+        return little_deserialization_library::deserialize_at<T, E> (static_cast<const std::remove_cv_t<B> *> (scratch.data()));
+    }
+
+    template<concepts::byte_like B, std::endian E> template<concepts::self_contained T> inline result<T> chunked_deserializer<B, E>::try_deserialize (void) noexcept
+    {
+        if (available_ < chunked_deserializer::deserialization_length<T>()) {
+            return make_error (error::not_enough_bytes);
+        }
+
+        const auto make{[this] { return deserialize_noexcept<T>(); }};
+        return result<T>{std::in_place, result_helpers::deferred<T, decltype(make)>{make}};
+    }
+
+    template<concepts::byte_like B, std::endian E> inline void chunked_deserializer<B, E>::skip (size_t bytes)
+    {
+        if (available_ < bytes) {
+            throw std::length_error{std::format ("impossible to skip {} bytes: available bytes {}", bytes, available_)};
+        }
+
+        advance (bytes);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<concepts::fixed_length T> inline void chunked_deserializer<B, E>::skip (void)
+    {
+        skip (deserialization_length<T>());
+    }
+}
@@ -2,16 +2,21 @@
 
 #include <span>
 #include <array>
+#include <bit>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
+#include "ldl_bulk_reader.hpp"
 #include "ldl_concepts.hpp"
+#include "ldl_isa.hpp"
 
 
-namespace little_deserialization_library
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
 {
     namespace array_view_helpers
     {
-        template<typename T1, std::size_t N, typename T2 = T1, size_t M = N> requires(M != std::dynamic_extent) auto to_array(std::span<T1, N> span)
+        template<typename T1, std::size_t N, typename T2 = T1, size_t M = N> requires(M != std::dynamic_extent) constexpr auto to_array(std::span<T1, N> span)
         {
             return[span]<std::size_t... Is>(std::index_sequence<Is...>) { return std::array<T2, M>{T2(span[Is])...}; } (std::make_index_sequence<M>());
         }
@@ -22,16 +27,60 @@ namespace little_deserialization_library
         using array_ptr_type = B(*)[N];
         using array_ref_type = B(&)[N];
 
-        explicit array_view(std::span<B, N> span) : span{ span } {}
-        template<size_t M> requires(M >= N) explicit array_view(std::span<B, M> span) : span{ span.template subspan<0, N>() } {}
+        constexpr explicit array_view(std::span<B, N> span) : span{ span } {}
+        template<size_t M> requires(M >= N) constexpr explicit array_view(std::span<B, M> span) : span{ span.template subspan<0, N>() } {}
 
         explicit operator array_ptr_type (void) const { return reinterpret_cast<array_ptr_type>(span.data()); }
         explicit operator array_ref_type (void) const { return *reinterpret_cast<array_ptr_type>(span.data()); }
-        template<typename B2 = B> explicit operator std::array<B2, N>(void) const { return array_view_helpers::to_array<B, N, B2>(span); }
+        template<typename B2 = B> constexpr explicit operator std::array<B2, N>(void) const { return array_view_helpers::to_array<B, N, B2>(span); }
 
 
         std::span<B, N> span;
     };
 
-    template<typename T> using to_array_ref_t = std::conditional_t<concepts::is_bounded_byte_array<T>, std::add_lvalue_reference_t<T>, T>;
+    /// <summary>
+    /// A view over the bytes of N elements of type T, stored with endianness E; the elements are converted when the view is cast to std::array.
+    /// </summary>
+    template<concepts::swappable_arithmetic T, size_t N, std::endian E, concepts::byte_like B> struct arithmetic_array_view
+    {
+        constexpr explicit arithmetic_array_view(std::span<B, N * sizeof(T)> span) : span{ span } {}
+
+        constexpr explicit operator std::array<T, N>(void) const { return bulk_reader::read_array<T, N, E>(span.data()); }
+
+
+        std::span<B, N * sizeof(T)> span;
+    };
+
+    /// <summary>
+    /// N elements of type T, already converted to the native endianness, which bind to a reference to the built-in array T[N].
+    /// </summary>
+    template<concepts::swappable_arithmetic T, size_t N> struct arithmetic_array
+    {
+        using array_ref_type = T(&)[N];
+        using const_array_ref_type = const T(&)[N];
+
+        constexpr explicit operator array_ref_type (void) { return values; }
+        constexpr explicit operator const_array_ref_type (void) const { return values; }
+        constexpr explicit operator std::array<T, N>(void) const
+        {
+            return[this]<std::size_t... Is>(std::index_sequence<Is...>) { return std::array<T, N>{values[Is]...}; } (std::make_index_sequence<N>());
+        }
+
+
+        T values[N];
+    };
+
+    /// <summary>
+    /// A view over a run of bytes whose length is read from the buffer; converts to std::span and std::string_view without copying.
+    /// </summary>
+    template<concepts::byte_like B> struct bytes_view
+    {
+        template<typename B2> requires(std::is_convertible_v<B(*)[], B2(*)[]>) operator std::span<B2>(void) const { return span; }
+        operator std::string_view (void) const { return std::string_view{reinterpret_cast<const char *>(span.data()), span.size()}; }
+
+
+        std::span<B> span;
+    };
+
+    template<typename T> using to_array_ref_t = std::conditional_t<std::is_bounded_array_v<T>, std::add_lvalue_reference_t<T>, T>;
 }
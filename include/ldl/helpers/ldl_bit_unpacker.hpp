@@ -0,0 +1,228 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "ldl_concepts.hpp"
+#include "ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace bit_unpacker_helpers
+    {
+        /// <summary>
+        /// Name of the bit-unpacking kernel selected at compile time: "avx2" or "scalar".
+        /// </summary>
+#if defined(__AVX2__)
+        inline constexpr const char * kernel_name{"avx2"};
+#else
+        inline constexpr const char * kernel_name{"scalar"};
+#endif
+
+        // Eight values of Bits bits take exactly Bits bytes, so that every group of eight starts on a byte boundary
+        inline constexpr size_t group_length{8U};
+
+        // Extracts the K-th value of a group, whose bit offset, first byte and byte count are known at compile time.
+        // Big endian packs values from the most significant bit of the first byte down, little endian from its least significant bit up
+        template<size_t Bits, std::endian E, size_t K, typename T, typename B> constexpr T extract (const B * group) noexcept
+        {
+            constexpr auto offset{K * Bits};
+            constexpr auto first{offset / 8U};
+            constexpr auto shift{offset % 8U};
+            constexpr auto length{(shift + Bits + 7U) / 8U};
+            constexpr auto mask{(uint64_t{1U} << Bits) - 1U};
+
+            uint64_t word{0U};
+            [group, &word] <size_t... Js> (std::index_sequence<Js...>) {
+                if constexpr (E == std::endian::big) {
+                    ((word = (word << 8U) | static_cast<uint8_t> (group[first + Js])), ...);
+                }
+                else {
+                    ((word |= uint64_t{static_cast<uint8_t> (group[first + Js])} << (8U * Js)), ...);
+                }
+            } (std::make_index_sequence<length>());
+
+            if constexpr (E == std::endian::big) {
+                return static_cast<T> ((word >> ((8U * length) - shift - Bits)) & mask);
+            }
+            else {
+                return static_cast<T> ((word >> shift) & mask);
+            }
+        }
+
+        // Unpacks the first "count" values of a group, count <= 8, reading no byte past them
+        template<size_t Bits, std::endian E, typename T, typename B> constexpr void unpack_group (const B * group, T * out, size_t count) noexcept
+        {
+            [group, out, count] <size_t... Ks> (std::index_sequence<Ks...>) {
+                ((Ks < count ? (void) (out[Ks] = extract<Bits, E, Ks, T> (group)) : (void) 0), ...);
+            } (std::make_index_sequence<group_length>());
+        }
+
+        template<size_t Bits, std::endian E, typename T, typename B> constexpr void scalar_unpack (const B * src, T * out, size_t count) noexcept
+        {
+            size_t done{0U};
+            for (; (done + group_length) <= count; done += group_length) {
+                [src, out, done] <size_t... Ks> (std::index_sequence<Ks...>) {
+                    ((out[done + Ks] = extract<Bits, E, Ks, T> (src + ((done / group_length) * Bits))), ...);
+                } (std::make_index_sequence<group_length>());
+            }
+            unpack_group<Bits, E> (src + ((done / group_length) * Bits), out + done, count - done);
+        }
+
+#if defined(__AVX2__)
+        // The widest values that fit in a 32-bit lane loaded at their first byte, whatever their bit offset in it
+        inline constexpr size_t lane_bits_max{25U};
+
+        // The byte of each value that every byte of a 32-bit lane is shuffled from, and the bit offset of the value in its lane.
+        // The four values of the upper half are shuffled from a second load, at the byte where the fifth value starts
+        template<size_t Bits, std::endian E> consteval auto lane_layout (void)
+        {
+            std::array<char, 32U> shuffle{};
+            std::array<int, 8U> shifts{};
+            for (size_t k{0U}; k < group_length; ++k) {
+                const auto base{(k < 4U) ? size_t{0U} : ((4U * Bits) / 8U)};
+                const auto offset{(k * Bits) - (8U * base)};
+                for (size_t j{0U}; j < 4U; ++j) {
+                    const auto byte{(offset / 8U) + ((E == std::endian::big) ? (3U - j) : j)};
+                    shuffle[(4U * k) + j] = static_cast<char> (byte);
+                }
+                shifts[k] = static_cast<int> (offset % 8U);
+            }
+            return std::pair{shuffle, shifts};
+        }
+
+        // Unpacks groups of eight values while 32 bytes can be loaded from the start of the group, and returns the number of values unpacked
+        template<size_t Bits, std::endian E, typename T> size_t avx2_unpack (const unsigned char * src, T * out, size_t count, size_t length) noexcept
+        {
+            static constexpr auto layout{lane_layout<Bits, E>()};
+            const auto shuffle{[] <size_t... Is> (std::index_sequence<Is...>) {
+                return _mm256_setr_epi8 (layout.first[Is]...);
+            } (std::make_index_sequence<32U>())};
+            const auto shifts{_mm256_setr_epi32 (layout.second[0], layout.second[1], layout.second[2], layout.second[3],
+                                                 layout.second[4], layout.second[5], layout.second[6], layout.second[7])};
+            const auto mask{_mm256_set1_epi32 (static_cast<int> ((uint64_t{1U} << Bits) - 1U))};
+            constexpr auto upper{(4U * Bits) / 8U};
+
+            size_t done{0U};
+            for (size_t read{0U}; ((done + group_length) <= count) && ((read + upper + 16U) <= length); done += group_length, read += Bits) {
+                const auto bytes{_mm256_set_m128i (_mm_loadu_si128 (reinterpret_cast<const __m128i *> (src + read + upper)),
+                                                   _mm_loadu_si128 (reinterpret_cast<const __m128i *> (src + read)))};
+                const auto lanes{_mm256_shuffle_epi8 (bytes, shuffle)};
+                __m256i values;
+                if constexpr (E == std::endian::big) {
+                    values = _mm256_srli_epi32 (_mm256_sllv_epi32 (lanes, shifts), static_cast<int> (32U - Bits));
+                }
+                else {
+                    values = _mm256_and_si256 (_mm256_srlv_epi32 (lanes, shifts), mask);
+                }
+
+                if constexpr (sizeof(T) == 4U) {
+                    _mm256_storeu_si256 (reinterpret_cast<__m256i *> (out + done), values);
+                }
+                else if constexpr (sizeof(T) == 8U) {
+                    _mm256_storeu_si256 (reinterpret_cast<__m256i *> (out + done), _mm256_cvtepu32_epi64 (_mm256_castsi256_si128 (values)));
+                    _mm256_storeu_si256 (reinterpret_cast<__m256i *> (out + done + 4U), _mm256_cvtepu32_epi64 (_mm256_extracti128_si256 (values, 1)));
+                }
+                else {
+                    // Values fit in T, so that packing with unsigned saturation keeps them as they are
+                    auto narrow{_mm_packus_epi32 (_mm256_castsi256_si128 (values), _mm256_extracti128_si256 (values, 1))};
+                    if constexpr (sizeof(T) == 1U) {
+                        _mm_storel_epi64 (reinterpret_cast<__m128i *> (out + done), _mm_packus_epi16 (narrow, narrow));
+                    }
+                    else {
+                        _mm_storeu_si128 (reinterpret_cast<__m128i *> (out + done), narrow);
+                    }
+                }
+            }
+            return done;
+        }
+#endif
+    }
+
+    namespace bit_unpacker
+    {
+        /// <summary>
+        /// Returns the number of bytes taken by "count" values of Bits bits packed back to back; the bits of the last byte past them are padding.
+        /// </summary>
+        template<size_t Bits> constexpr size_t packed_length (size_t count) noexcept { return ((count * Bits) + 7U) / 8U; }
+
+        /// <summary>
+        /// Unpacks "count" values of Bits bits, packed back to back from src, to out: from the most significant bit of every byte down
+        /// for big endian, from its least significant bit up for little endian. Reads packed_length&lt;Bits&gt;(count) bytes, and no byte past them.
+        /// Groups of eight values, which take Bits bytes, are unpacked with one byte shuffle and one shift per lane where AVX2 is available
+        /// and Bits is at most 25; otherwise every value is extracted at a bit offset known at compile time.
+        /// </summary>
+        template<size_t Bits, std::endian E, std::unsigned_integral T, concepts::byte_like B> constexpr void unpack (const B * src, T * out, size_t count) noexcept
+        {
+            static_assert((Bits > 0U) && (Bits <= 32U) && (Bits <= (8U * sizeof(T))), "values must be 1 to 32 bits wide, and fit in T");
+
+            size_t done{0U};
+#if defined(__AVX2__)
+            if constexpr ((Bits <= bit_unpacker_helpers::lane_bits_max) && !std::is_same_v<T, bool>) {
+                if (!std::is_constant_evaluated()) {
+                    done = bit_unpacker_helpers::avx2_unpack<Bits, E> (reinterpret_cast<const unsigned char *> (src), out, count, packed_length<Bits> (count));
+                }
+            }
+#endif
+            bit_unpacker_helpers::scalar_unpack<Bits, E> (src + ((done / bit_unpacker_helpers::group_length) * Bits), out + done, count - done);
+        }
+
+        /// <summary>
+        /// Packs "count" values of Bits bits back to back to dst, as unpack reads them back; bits of a value past its Bits lowest ones are dropped.
+        /// Writes packed_length&lt;Bits&gt;(count) bytes; the padding bits of the last byte are left as they are.
+        /// </summary>
+        template<size_t Bits, std::endian E, std::unsigned_integral T, concepts::byte_like B> constexpr void pack (const T * values, B * dst, size_t count) noexcept
+        {
+            static_assert((Bits > 0U) && (Bits <= 32U), "values must be 1 to 32 bits wide");
+            static_assert(!std::is_const_v<B>, "cannot write to const bytes");
+            constexpr auto mask{(uint64_t{1U} << Bits) - 1U};
+
+            // The bits not written yet, in the pending lowest ones of the accumulator
+            uint64_t pending{0U};
+            size_t pending_bits{0U};
+            for (size_t i{0U}; i < count; ++i) {
+                const auto value{static_cast<uint64_t> (values[i]) & mask};
+                if constexpr (E == std::endian::big) {
+                    pending = (pending << Bits) | value;
+                }
+                else {
+                    pending |= value << pending_bits;
+                }
+                pending_bits += Bits;
+
+                for (; pending_bits >= 8U; pending_bits -= 8U) {
+                    if constexpr (E == std::endian::big) {
+                        *dst++ = static_cast<B> (static_cast<uint8_t> (pending >> (pending_bits - 8U)));
+                    }
+                    else {
+                        *dst++ = static_cast<B> (static_cast<uint8_t> (pending));
+                        pending >>= 8U;
+                    }
+                }
+                pending &= (uint64_t{1U} << pending_bits) - 1U;
+            }
+
+            if (pending_bits != 0U) {
+                const auto padding{static_cast<uint8_t> (*dst)};
+                if constexpr (E == std::endian::big) {
+                    const auto padding_mask{static_cast<uint8_t> ((1U << (8U - pending_bits)) - 1U)};
+                    *dst = static_cast<B> (static_cast<uint8_t> ((pending << (8U - pending_bits)) | (padding & padding_mask)));
+                }
+                else {
+                    const auto padding_mask{static_cast<uint8_t> (~((1U << pending_bits) - 1U))};
+                    *dst = static_cast<B> (static_cast<uint8_t> (pending | (padding & padding_mask)));
+                }
+            }
+        }
+    }
+}
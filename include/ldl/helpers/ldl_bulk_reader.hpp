@@ -0,0 +1,289 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#include "ldl_concepts.hpp"
+#include "ldl_isa.hpp"
+#include "ldl_reader.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace bulk_reader_helpers
+    {
+        /// <summary>
+        /// Name of the byte-shuffle kernel selected at compile time: "avx2", "ssse3", or "scalar".
+        /// </summary>
+#if defined(__AVX2__)
+        inline constexpr const char * kernel_name{"avx2"};
+#elif defined(__SSSE3__)
+        inline constexpr const char * kernel_name{"ssse3"};
+#else
+        inline constexpr const char * kernel_name{"scalar"};
+#endif
+
+        // Arrays shorter than this many bytes are converted element by element, fully unrolled
+        inline constexpr size_t unrolled_array_max_length{64U};
+
+        // Number of elements gathered before they are swapped in place, so that the swap pass runs on L1-resident data
+        inline constexpr size_t strided_block_length{1024U};
+
+        template<size_t Size> using unsigned_of_size_t = std::conditional_t<Size == 2U, uint16_t, std::conditional_t<Size == 4U, uint32_t, uint64_t>>;
+
+        template<size_t Size> void scalar_swap_copy (const unsigned char * src, unsigned char * dst, size_t count) noexcept
+        {
+            using U = unsigned_of_size_t<Size>;
+            for (size_t i{0U}; i < count; ++i) {
+                U value;
+                std::memcpy (&value, src + (i * Size), Size);
+                value = reader_helpers::integral_swap (value);
+                std::memcpy (dst + (i * Size), &value, Size);
+            }
+        }
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+        // Byte-shuffle mask reversing every Size-byte lane of a 16-byte register
+        template<size_t Size> inline __m128i shuffle_mask_128 (void) noexcept
+        {
+            return [] <size_t... Is> (std::index_sequence<Is...>) {
+                return _mm_setr_epi8 (static_cast<char> ((Is / Size) * Size + (Size - 1U - (Is % Size)))...);
+            } (std::make_index_sequence<16U>());
+        }
+#endif
+
+        // Objects up to this many bytes are converted with one byte shuffle per 16-byte block
+        inline constexpr size_t shuffled_object_max_length{64U};
+
+        /// <summary>
+        /// A run of "count" contiguous multi-byte elements of "size" bytes at a fixed offset of an object representation,
+        /// whose bytes are reversed element by element to convert their endianness.
+        /// </summary>
+        struct swap_unit
+        {
+            size_t offset;
+            size_t size;
+            size_t count;
+        };
+
+        // Length of the prefix of an N-byte object representation made of whole 16-byte blocks that no element straddles
+        template<size_t N, auto Units> consteval size_t shuffle_prefix_length (void)
+        {
+            if (N > shuffled_object_max_length) {
+                return 0U;
+            }
+
+            size_t length{0U};
+            for (; (length + 16U) <= N; length += 16U) {
+                const auto boundary{length + 16U};
+                const auto straddles{[boundary] (swap_unit unit) {
+                    for (size_t i{0U}; i < unit.count; ++i) {
+                        const auto offset{unit.offset + (i * unit.size)};
+                        if ((offset < boundary) && ((offset + unit.size) > boundary)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }};
+                if (std::ranges::any_of (Units, straddles)) {
+                    break;
+                }
+            }
+
+            return length;
+        }
+
+        /// <summary>
+        /// Copies "count" elements of Size bytes from src to dst, reversing the byte order of each element.
+        /// src and dst may be the same address, but must not otherwise overlap.
+        /// </summary>
+        template<size_t Size> void swap_copy (const unsigned char * src, unsigned char * dst, size_t count) noexcept
+        {
+            static_assert((Size == 2U) || (Size == 4U) || (Size == 8U), "only elements of 2, 4, or 8 bytes can be swapped");
+
+            size_t done{0U};
+#if defined(__AVX2__) || defined(__SSSE3__)
+            const auto mask_128{shuffle_mask_128<Size>()};
+#endif
+#if defined(__AVX2__)
+            const auto mask_256{_mm256_broadcastsi128_si256 (mask_128)};
+            constexpr size_t per_256{32U / Size};
+            for (; (done + per_256) <= count; done += per_256) {
+                const auto value{_mm256_loadu_si256 (reinterpret_cast<const __m256i *> (src + (done * Size)))};
+                _mm256_storeu_si256 (reinterpret_cast<__m256i *> (dst + (done * Size)), _mm256_shuffle_epi8 (value, mask_256));
+            }
+#endif
+#if defined(__AVX2__) || defined(__SSSE3__)
+            constexpr size_t per_128{16U / Size};
+            for (; (done + per_128) <= count; done += per_128) {
+                const auto value{_mm_loadu_si128 (reinterpret_cast<const __m128i *> (src + (done * Size)))};
+                _mm_storeu_si128 (reinterpret_cast<__m128i *> (dst + (done * Size)), _mm_shuffle_epi8 (value, mask_128));
+            }
+#endif
+            scalar_swap_copy<Size> (src + (done * Size), dst + (done * Size), count - done);
+        }
+
+        template<size_t Size> void swap_in_place (unsigned char * bytes) noexcept
+        {
+            using U = unsigned_of_size_t<Size>;
+
+            U value;
+            std::memcpy (&value, bytes, Size);
+            value = reader_helpers::integral_swap (value);
+            std::memcpy (bytes, &value, Size);
+        }
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+        // Shuffles the 16-byte block at Offset, reversing the bytes of every unit that lies in it
+        template<size_t Offset, auto Units> inline void shuffle_block (unsigned char * bytes) noexcept
+        {
+            static constexpr auto mask{[] {
+                std::array<char, 16U> mask;
+                for (size_t i{0U}; i < mask.size(); ++i) {
+                    mask[i] = static_cast<char> (i);
+                }
+                for (const auto unit : Units) {
+                    for (size_t e{0U}; e < unit.count; ++e) {
+                        const auto offset{unit.offset + (e * unit.size)};
+                        if ((offset >= Offset) && (offset < (Offset + 16U))) {
+                            for (size_t i{0U}; i < unit.size; ++i) {
+                                mask[offset - Offset + i] = static_cast<char> (offset - Offset + unit.size - 1U - i);
+                            }
+                        }
+                    }
+                }
+                return mask;
+            } ()};
+
+            const auto value{_mm_loadu_si128 (reinterpret_cast<const __m128i *> (bytes + Offset))};
+            _mm_storeu_si128 (reinterpret_cast<__m128i *> (bytes + Offset),
+                              _mm_shuffle_epi8 (value, _mm_loadu_si128 (reinterpret_cast<const __m128i *> (mask.data()))));
+        }
+#endif
+
+        // Reverses, in place, the bytes of the elements of Unit that lie after the first "skipped" bytes of the object representation
+        template<swap_unit Unit, size_t Skipped> void swap_unit_tail (unsigned char * bytes) noexcept
+        {
+            constexpr auto first{(Unit.offset >= Skipped) ? 0U : std::min (Unit.count, (Skipped - Unit.offset + Unit.size - 1U) / Unit.size)};
+            if constexpr ((Unit.count - first) == 1U) {
+                swap_in_place<Unit.size> (bytes + Unit.offset + (first * Unit.size));
+            }
+            else if constexpr ((Unit.count - first) > 1U) {
+                const auto run{bytes + Unit.offset + (first * Unit.size)};
+                swap_copy<Unit.size> (run, run, Unit.count - first);
+            }
+        }
+
+        // Reverses, in place, the bytes of the elements of every unit that lie after the first "skipped" bytes of the object representation
+        template<auto Units, size_t Skipped> void swap_unit_tails (unsigned char * bytes) noexcept
+        {
+            [bytes] <size_t... Us> (std::index_sequence<Us...>) {
+                (swap_unit_tail<Units[Us], Skipped> (bytes), ...);
+            } (std::make_index_sequence<Units.size()>());
+        }
+
+        /// <summary>
+        /// Reverses, in place, the bytes of every element of every unit of an N-byte object representation.
+        /// For small objects, the 16-byte blocks that no element straddles are converted with a single byte shuffle each;
+        /// the remaining elements are converted unit by unit.
+        /// </summary>
+        template<size_t N, auto Units> void swap_units (unsigned char * bytes) noexcept
+        {
+#if defined(__AVX2__) || defined(__SSSE3__)
+            constexpr auto shuffled_length{shuffle_prefix_length<N, Units>()};
+            [bytes] <size_t... Blocks> (std::index_sequence<Blocks...>) {
+                (shuffle_block<Blocks * 16U, Units> (bytes), ...);
+            } (std::make_index_sequence<shuffled_length / 16U>());
+            swap_unit_tails<Units, shuffled_length> (bytes);
+#else
+            swap_unit_tails<Units, 0U> (bytes);
+#endif
+        }
+    }
+
+    namespace bulk_reader
+    {
+        /// <summary>
+        /// Reads "count" contiguous elements of type T, stored with endianness E, from src into dst.
+        /// </summary>
+        template<concepts::non_bool_arithmetic T, std::endian E = std::endian::big, concepts::byte_like B> void read (const B * src, T * dst, size_t count) noexcept
+        {
+            const auto bytes{reinterpret_cast<const unsigned char *> (src)};
+            if constexpr ((std::endian::native != E) && concepts::swappable_arithmetic<T>) {
+                bulk_reader_helpers::swap_copy<sizeof(T)> (bytes, reinterpret_cast<unsigned char *> (dst), count);
+            }
+            else {
+                std::memcpy (dst, bytes, count * sizeof(T));
+            }
+        }
+
+        /// <summary>
+        /// Reads N contiguous elements of type T, stored with endianness E, from src into dst.
+        /// Short arrays are converted element by element with a fully unrolled sequence of reads; long arrays use the bulk kernel, except in constant evaluation.
+        /// </summary>
+        template<concepts::non_bool_arithmetic T, size_t N, std::endian E = std::endian::big, concepts::byte_like B> constexpr void read_n (const B * src, T * dst) noexcept
+        {
+            if (std::is_constant_evaluated()) {
+                for (size_t i{0U}; i < N; ++i) {
+                    dst[i] = reader::read<T, E> (src + (i * sizeof(T)));
+                }
+            }
+            else if constexpr ((N * sizeof(T)) < bulk_reader_helpers::unrolled_array_max_length) {
+                [src, dst] <size_t... Is> (std::index_sequence<Is...>) {
+                    ((dst[Is] = reader::read<T, E> (src + (Is * sizeof(T)))), ...);
+                } (std::make_index_sequence<N>());
+            }
+            else {
+                read<T, E> (src, dst, N);
+            }
+        }
+
+        /// <summary>
+        /// Reads N contiguous elements of type T, stored with endianness E, from src.
+        /// </summary>
+        template<concepts::non_bool_arithmetic T, size_t N, std::endian E = std::endian::big, concepts::byte_like B> constexpr std::array<T, N> read_array (const B * src) noexcept
+        {
+            std::array<T, N> values;
+            read_n<T, N, E> (src, values.data());
+
+            return values;
+        }
+
+        /// <summary>
+        /// Reads "count" elements of type T, stored with endianness E, from src into dst; consecutive elements are "stride" bytes apart in src.
+        /// Elements are gathered in blocks, and each block is then byte-swapped in place by the bulk kernel.
+        /// </summary>
+        template<concepts::non_bool_arithmetic T, std::endian E = std::endian::big, concepts::byte_like B>
+            void read_strided (const B * src, size_t stride, T * dst, size_t count) noexcept
+        {
+            if (stride == sizeof(T)) {
+                read<T, E> (src, dst, count);
+                return;
+            }
+
+            for (size_t done{0U}; done < count;) {
+                const auto block{std::min (count - done, bulk_reader_helpers::strided_block_length)};
+                for (size_t i{0U}; i < block; ++i) {
+                    dst[done + i] = reader_helpers::read_no_swap<T> (src + ((done + i) * stride));
+                }
+                if constexpr ((std::endian::native != E) && concepts::swappable_arithmetic<T>) {
+                    const auto bytes{reinterpret_cast<unsigned char *> (dst + done)};
+                    bulk_reader_helpers::swap_copy<sizeof(T)> (bytes, bytes, block);
+                }
+                done += block;
+            }
+        }
+    }
+}
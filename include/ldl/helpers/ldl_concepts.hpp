@@ -5,8 +5,11 @@
 #include <concepts>
 #include <type_traits>
 
+#include "ldl_deserialization_rules.hpp"
+#include "ldl_isa.hpp"
 
-namespace little_deserialization_library::concepts
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE::concepts
 {
     /// <summary>
     /// Requires that T is a bool.
@@ -74,14 +77,65 @@ namespace little_deserialization_library::concepts
     template<typename A> concept is_bounded_byte_array = std::is_bounded_array_v<A> && (std::rank_v<A> == 1U) &&
                                                          concepts::byte_like<std::remove_all_extents_t<A>>;
 
+    /// <summary>
+    /// Requires that A is a bounded built-in array of rank 1, whose elements satisfy the swappable_arithmetic concept.
+    /// </summary>
+    template<typename A> concept is_bounded_swappable_array = std::is_bounded_array_v<A> && (std::rank_v<A> == 1U) &&
+                                                              concepts::swappable_arithmetic<std::remove_cv_t<std::remove_extent_t<A>>>;
+
+    /// <summary>
+    /// Requires that A is either a specialization of std::array or a bounded built-in array, whose elements satisfy the swappable_arithmetic concept.
+    /// </summary>
+    template<typename A> concept is_swappable_array = is_bounded_swappable_array<A> ||
+                                                      (is_std_array<A> && concepts::swappable_arithmetic<std::tuple_element_t<0, A>>);
+
     /// <summary>
     /// Requires that A is either a specialization of std::array or a bounded built-in array.
     /// </summary>
-    template<typename A> concept is_any_array = is_std_array<A> || is_bounded_byte_array<A>;
+    template<typename A> concept is_any_array = is_std_array<A> || is_bounded_byte_array<A> || is_bounded_swappable_array<A>;
+
+    /// <summary>
+    /// Requires that E is of any arithmetic type except bool, or a specialization of std::array of such types.
+    /// </summary>
+    template<typename E> concept plain_rule_element = non_bool_arithmetic<E> || (is_std_array<E> && non_bool_arithmetic<std::tuple_element_t<0, E>>);
 
     /// <summary>
     /// Requires that S is a specialization of std::span with a static extent and a byte-like element_type.
     /// </summary>
     template<typename S> concept is_static_extent_byte_span = std::is_same_v<S, std::span<typename S::element_type, S::extent>> &&
                                                               concepts::byte_like<typename S::element_type> && (S::extent != std::dynamic_extent);
+
+    /// <summary>
+    /// Requires that T is a specialization of skip or ignore, standing for bytes that are skipped rather than deserialized.
+    /// </summary>
+    template<typename T> concept skipped_element = is_skipped_element<T>::value;
+
+    /// <summary>
+    /// Requires that T is a specialization of bits, standing for a word split into bit fields.
+    /// </summary>
+    template<typename T> concept bit_fields = is_bit_fields<T>::value;
+
+    /// <summary>
+    /// Requires that T is a specialization of packed_array, standing for values of fewer bits than their type packed back to back.
+    /// </summary>
+    template<typename T> concept packed_array_element = is_packed_array<T>::value;
+
+    /// <summary>
+    /// Requires that T is a specialization of varint or zigzag, an integer encoded in a variable number of bytes.
+    /// </summary>
+    template<typename T> concept varint_element = is_varint<T>::value;
+
+    /// <summary>
+    /// Requires that T is a specialization of length_prefixed, sized_by, variant_on, repeated, varint, or zigzag,
+    /// whose length depends on the content of the buffer.
+    /// </summary>
+    template<typename T> concept dynamic_element = is_length_prefixed<T>::value || is_sized_by<T>::value || is_variant_on<T>::value || is_repeated<T>::value ||
+                                                   varint_element<T>;
+
+    /// <summary>
+    /// Requires that T is neither arithmetic, nor an array, nor a std::span with a static extent, nor a skipped element, nor bit fields,
+    /// nor packed values, nor a dynamic element: T is deserialized through its deserialization rule.
+    /// </summary>
+    template<typename T> concept ruled = !non_bool_arithmetic<T> && !is_any_array<T> && !is_static_extent_byte_span<T> && !skipped_element<T> &&
+                                         !bit_fields<T> && !packed_array_element<T> && !dynamic_element<T>;
 }
@@ -1,8 +1,241 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <concepts>
 #include <type_traits>
 #include <tuple>
+#include <variant>
+
+#include "ldl_dispatch.hpp"
+#include "ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// A deserialization rule element standing for N bytes that are skipped: they count toward the deserialization length, but are never read.
+    /// </summary>
+    template<size_t N> struct skip { };
+
+    /// <summary>
+    /// A deserialization rule element standing for the bytes of an object of type T that are skipped: they count toward the deserialization length,
+    /// but are never read.
+    /// </summary>
+    template<typename T> struct ignore { };
+
+    /// <summary>
+    /// A deserialization rule element standing for a word of type U, split into bit fields of the given widths, from the most significant bit down.
+    /// The word is read once, with endian conversion, and every field becomes a separate argument of the constructor of the deserialized object,
+    /// of the smallest unsigned type that holds it.
+    /// </summary>
+    template<typename U, size_t... Widths> requires(std::unsigned_integral<U> && !std::is_same_v<U, bool>) struct bits
+    {
+        static_assert(((Widths > 0U) && ...), "bit fields must be at least one bit wide");
+        static_assert((Widths + ...) == (8U * sizeof(U)), "the widths of the bit fields must add up to the width of the word");
+
+        static constexpr std::array<size_t, sizeof...(Widths)> widths{Widths...};
+
+        template<size_t K> using field_type = std::conditional_t<(widths[K] <= 8U), uint8_t,
+                                                 std::conditional_t<(widths[K] <= 16U), uint16_t, std::conditional_t<(widths[K] <= 32U), uint32_t, uint64_t>>>;
+
+        /// <summary>
+        /// Returns the number of bit fields.
+        /// </summary>
+        static consteval size_t size (void) { return sizeof...(Widths); }
+
+        /// <summary>
+        /// Extracts the K-th bit field, counting from the most significant bit.
+        /// </summary>
+        template<size_t K> constexpr field_type<K> get (void) const noexcept
+        {
+            if constexpr (widths[K] == (8U * sizeof(U))) {
+                return static_cast<field_type<K>> (word);
+            }
+            else {
+                return static_cast<field_type<K>> ((word >> shift<K>()) & mask<K>());
+            }
+        }
+
+        /// <summary>
+        /// Replaces the K-th bit field, counting from the most significant bit, with the low bits of "value".
+        /// </summary>
+        template<size_t K> constexpr void set (field_type<K> value) noexcept
+        {
+            if constexpr (widths[K] == (8U * sizeof(U))) {
+                word = static_cast<U> (value);
+            }
+            else {
+                word = static_cast<U> ((word & ~(mask<K>() << shift<K>())) | ((static_cast<U> (value) & mask<K>()) << shift<K>()));
+            }
+        }
+
+
+        U word;
+
+    private:
+        template<size_t K> static consteval size_t shift (void)
+        {
+            size_t shift{0U};
+            for (auto i{K + 1U}; i < widths.size(); ++i) {
+                shift += widths[i];
+            }
+            return shift;
+        }
+
+        template<size_t K> static consteval U mask (void) { return static_cast<U> ((U{1U} << widths[K]) - 1U); }
+    };
+
+    template<typename T> struct is_bit_fields : std::false_type { };
+    template<typename U, size_t... Widths> struct is_bit_fields<bits<U, Widths...>> : std::true_type { };
+
+    /// <summary>
+    /// A deserialization rule element standing for Count unsigned values of Bits bits each, packed back to back with no padding between them,
+    /// as the 10-, 12- or 20-bit samples of sensor frames: from the most significant bit of every byte down for big endian rules,
+    /// from its least significant bit up for little endian ones. It takes (Bits * Count + 7) / 8 bytes and converts to std::array&lt;T, Count&gt;.
+    /// </summary>
+    template<size_t Bits, size_t Count, typename T = std::conditional_t<(Bits <= 8U), uint8_t, std::conditional_t<(Bits <= 16U), uint16_t, uint32_t>>>
+        requires(std::unsigned_integral<T> && !std::is_same_v<T, bool> && (Bits > 0U) && (Bits <= 32U) && (Bits <= (8U * sizeof(T))))
+    struct packed_array
+    {
+        static constexpr size_t bits{Bits};
+        using value_type = T;
+        using array_type = std::array<T, Count>;
+
+        constexpr operator array_type (void) const noexcept { return values; }
+
+        array_type values;
+    };
+
+    /// <summary>
+    /// A deserialization rule element standing for a run of bytes preceded by its length, stored as an unsigned integer of type L.
+    /// The bytes are not copied: the element converts to a std::span or a std::string_view over the buffer.
+    /// </summary>
+    template<typename L> requires(std::unsigned_integral<L> && !std::is_same_v<L, bool>) struct length_prefixed
+    {
+        using length_type = L;
+    };
+
+    /// <summary>
+    /// A deserialization rule element standing for an unsigned integer of type U, encoded as a LEB128 varint: seven bits per byte,
+    /// least significant group first, with the top bit of every byte but the last one set. It takes 1 to (8 * sizeof(U) + 6) / 7 bytes,
+    /// whatever the endianness of the rule, and converts to U.
+    /// </summary>
+    template<typename U> requires(std::unsigned_integral<U> && !std::is_same_v<U, bool>) struct varint
+    {
+        using value_type = U;
+
+        constexpr operator U (void) const noexcept { return value; }
+
+        U value;
+    };
 
+    /// <summary>
+    /// A deserialization rule element standing for a signed integer of type S, zigzag-encoded into an unsigned LEB128 varint, as the sint32 and
+    /// sint64 fields of Protocol Buffers: 0, -1, 1, -2 are encoded as 0, 1, 2, 3, so that values of small magnitude take few bytes. Converts to S.
+    /// </summary>
+    template<typename S> requires(std::signed_integral<S>) struct zigzag
+    {
+        using value_type = S;
+
+        constexpr operator S (void) const noexcept { return value; }
+
+        S value;
+    };
+
+    /// <summary>
+    /// A deserialization rule element standing for a run of bytes whose length is the value of the I-th element of the same rule,
+    /// which must be an integral or a varint element that precedes it.
+    /// The bytes are not copied: the element converts to a std::span or a std::string_view over the buffer.
+    /// </summary>
+    template<size_t I> struct sized_by
+    {
+        static constexpr size_t index{I};
+    };
+
+    /// <summary>
+    /// A deserialization rule element standing for back-to-back records of type T, whose count is the value of the I-th element of the same rule,
+    /// which must be an integral element that precedes it; e.g. repeated<1, route_entry> for the entries of a routing update.
+    /// The records are decoded into a std::pmr::vector&lt;T&gt;, whose capacity is reserved once from the count, drawn from the memory resource
+    /// passed to deserialize or try_deserialize, or from the default memory resource. T must have a length known at compile time.
+    /// </summary>
+    template<size_t I, typename T> struct repeated
+    {
+        static constexpr size_t index{I};
+        using value_type = T;
+    };
+
+    /// <summary>
+    /// An alternative of variant_on: objects of type T are deserialized when the key is Key.
+    /// </summary>
+    template<auto Key, typename T> struct on
+    {
+        static constexpr auto key{Key};
+        using type = T;
+    };
+
+    /// <summary>
+    /// The std::variant produced by the alternatives Cases: std::monostate when no alternative matches the key.
+    /// </summary>
+    template<typename... Cases> using variant_of = std::variant<std::monostate, typename Cases::type...>;
+
+    /// <summary>
+    /// A set of alternatives, each deserializing objects of a different type, selected by a key through a perfect hash computed at compile time.
+    /// </summary>
+    template<typename... Cases> struct alternatives
+    {
+        using value_type = variant_of<Cases...>;
+
+        template<size_t A> using alternative_t = std::variant_alternative_t<A, value_type>;
+
+        /// <summary>
+        /// Returns the number of alternatives.
+        /// </summary>
+        static consteval size_t size (void) { return sizeof...(Cases); }
+
+        /// <summary>
+        /// Returns the index in value_type of the alternative selected by key, or 0 (std::monostate) if no alternative matches it.
+        /// </summary>
+        static constexpr size_t find (uint64_t key) noexcept
+        { return dispatch::perfect_hash<static_cast<uint64_t> (Cases::key)...>::find (key); }
+    };
+
+    /// <summary>
+    /// A deserialization rule element standing for an object whose type is selected by the value of the I-th element of the same rule,
+    /// which must be an integral element that precedes it; e.g. variant_on<2, on<0x0800, ip_header>, on<0x86DD, ipv6_header>>.
+    /// Deserializes to a std::variant, which holds std::monostate, and consumes no bytes, when no alternative matches the key.
+    /// </summary>
+    template<size_t I, typename... Cases> struct variant_on : alternatives<Cases...>
+    {
+        static constexpr size_t index{I};
+    };
+
+    template<typename T> struct is_variant_on : std::false_type { };
+    template<size_t I, typename... Cases> struct is_variant_on<variant_on<I, Cases...>> : std::true_type { };
+
+    template<typename T> struct is_length_prefixed : std::false_type { };
+    template<typename L> struct is_length_prefixed<length_prefixed<L>> : std::true_type { };
+
+    template<typename T> struct is_sized_by : std::false_type { };
+    template<size_t I> struct is_sized_by<sized_by<I>> : std::true_type { };
+
+    template<typename T> struct is_repeated : std::false_type { };
+    template<size_t I, typename T> struct is_repeated<repeated<I, T>> : std::true_type { };
+
+    template<typename T> struct is_packed_array : std::false_type { };
+    template<size_t Bits, size_t Count, typename T> struct is_packed_array<packed_array<Bits, Count, T>> : std::true_type { };
+
+    template<typename T> struct is_varint : std::false_type { };
+    template<typename U> struct is_varint<varint<U>> : std::true_type { };
+    template<typename S> struct is_varint<zigzag<S>> : std::true_type { };
+
+    template<typename T> struct is_skipped_element : std::false_type { };
+    template<size_t N> struct is_skipped_element<skip<N>> : std::true_type { };
+    template<typename T> struct is_skipped_element<ignore<T>> : std::true_type { };
+}
 
-namespace little_deserialization_library::deserialization_rules
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE::deserialization_rules
 {
     template<typename T> struct rule
     {
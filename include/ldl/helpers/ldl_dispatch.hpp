@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace dispatch_helpers
+    {
+        // Largest table searched for a perfect hash of a set of keys
+        inline constexpr size_t max_modulus{4096U};
+
+        template<size_t N> consteval bool distinct (const std::array<uint64_t, N> & keys)
+        {
+            for (size_t i{0U}; i < N; ++i) {
+                for (auto j{i + 1U}; j < N; ++j) {
+                    if (keys[i] == keys[j]) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        // The smallest modulus not less than N that maps the keys to distinct slots, or 0 if there is none up to max_modulus
+        template<size_t N> consteval size_t perfect_modulus (const std::array<uint64_t, N> & keys)
+        {
+            for (auto modulus{N}; modulus <= max_modulus; ++modulus) {
+                std::array<uint64_t, N> slots{};
+                for (size_t i{0U}; i < N; ++i) {
+                    slots[i] = keys[i] % modulus;
+                }
+                if (distinct (slots)) {
+                    return modulus;
+                }
+            }
+
+            return 0U;
+        }
+    }
+
+    namespace dispatch
+    {
+        /// <summary>
+        /// A perfect hash of a set of keys, computed at compile time: every key is mapped to its own slot of a table by the remainder of
+        /// its division by a constant modulus, so that a key is looked up with a division, a load, and a comparison.
+        /// </summary>
+        template<uint64_t... Keys> struct perfect_hash
+        {
+            static constexpr std::array<uint64_t, sizeof...(Keys)> keys{Keys...};
+
+            static_assert(sizeof...(Keys) > 0U, "at least one key is required");
+            static_assert(dispatch_helpers::distinct (keys), "the keys must be distinct");
+
+            static constexpr size_t modulus{dispatch_helpers::perfect_modulus (keys)};
+
+            static_assert(modulus != 0U, "no perfect hash of the keys fits in a table of max_modulus slots");
+
+            // The 1-based index of the key that maps to each slot, or 0 for empty slots
+            static constexpr auto slots{[] {
+                std::array<size_t, modulus> slots{};
+                for (size_t i{0U}; i < keys.size(); ++i) {
+                    slots[keys[i] % modulus] = i + 1U;
+                }
+                return slots;
+            } ()};
+
+            /// <summary>
+            /// Returns the 1-based index of key among Keys, or 0 if key is not among them.
+            /// </summary>
+            static constexpr size_t find (uint64_t key) noexcept
+            {
+                const auto slot{slots[key % modulus]};
+                return ((slot != 0U) && (keys[slot - 1U] == key)) ? slot : 0U;
+            }
+        };
+    }
+}
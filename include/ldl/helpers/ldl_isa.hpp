@@ -0,0 +1,20 @@
+#pragma once
+
+
+// The name of the inline namespace in which every entity of the library is declared: it names the instruction sets that the kernels
+// are built for, as selected by the -m flags of the translation unit. Inline functions that call a kernel, directly or not, then get
+// a different mangled name for each instruction set, so that translation units built with different flags never share a definition,
+// e.g. the AVX2 instantiation of a deserialize_at kept by the linker for code meant to run on a baseline CPU.
+#if defined(__AVX2__) && defined(__BMI2__)
+#define LDL_ISA_NAMESPACE avx2_bmi2
+#elif defined(__AVX2__)
+#define LDL_ISA_NAMESPACE avx2
+#elif defined(__SSSE3__) && defined(__BMI2__)
+#define LDL_ISA_NAMESPACE ssse3_bmi2
+#elif defined(__SSSE3__)
+#define LDL_ISA_NAMESPACE ssse3
+#elif defined(__BMI2__)
+#define LDL_ISA_NAMESPACE bmi2
+#else
+#define LDL_ISA_NAMESPACE scalar
+#endif
@@ -1,18 +1,28 @@
 #pragma once
 
+#include <array>
 #include <bit>
 #include <memory>
+#include <type_traits>
+#include <version>
 
 #include "ldl_concepts.hpp"
+#include "ldl_isa.hpp"
 
 
-namespace little_deserialization_library
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
 {
     namespace reader_helpers
     {
         template<concepts::swappable_integral T> [[nodiscard]] constexpr T integral_swap (T t)
         {
-            if constexpr (sizeof(T) == 2) {
+#if defined(__cpp_lib_byteswap)
+            return std::byteswap (t);
+#else
+            if constexpr (std::is_signed_v<T>) {
+                return T(integral_swap (std::make_unsigned_t<T>(t)));
+            }
+            else if constexpr (sizeof(T) == 2) {
                 return T((t & T(0xFF00)) >> 8) | T(((t & T(0x00FF)) << 8));
             }
             else if constexpr (sizeof(T) == 4) {
@@ -28,42 +38,33 @@ namespace little_deserialization_library
                        T((t & T(0x000000000000FF00LL)) << 40) |
                        T((t & T(0x00000000000000FFLL)) << 56);
             }
+#endif
         }
 
-        template<concepts::non_bool_integral T, std::floating_point F> requires(sizeof(T) == sizeof(F)) T to_integral (F f)
+        template<concepts::non_bool_integral T, std::floating_point F> requires(sizeof(T) == sizeof(F)) constexpr T to_integral (F f)
         {
-            using byte_array = unsigned char *;
-
-            T t;
-            std::copy (std::bit_cast<byte_array> (&f), std::bit_cast<byte_array> (&f) + sizeof(F), std::bit_cast<byte_array> (&t));
-
-            return t;
+            return std::bit_cast<T> (f);
         }
 
-        template<std::floating_point F, concepts::non_bool_integral T> requires(sizeof(T) == sizeof(F)) F to_floating_point (T t)
+        template<std::floating_point F, concepts::non_bool_integral T> requires(sizeof(T) == sizeof(F)) constexpr F to_floating_point (T t)
         {
-            using byte_array = unsigned char *;
-
-            F f;
-            std::copy (std::bit_cast<byte_array> (&t), std::bit_cast<byte_array> (&t) + sizeof(T), std::bit_cast<byte_array> (&f));
-
-            return f;
+            return std::bit_cast<F> (t);
         }
 
-        template<concepts::non_bool_integral T, std::floating_point F> requires(sizeof(T) == sizeof(F)) F floating_point_swap (F f)
+        template<concepts::non_bool_integral T, std::floating_point F> requires(sizeof(T) == sizeof(F)) constexpr F floating_point_swap (F f)
         {
             return to_floating_point<F, T> (integral_swap (to_integral<T, F> (f)));
         }
 
-        template<concepts::swappable_arithmetic T> T swap (T t)
+        template<concepts::swappable_arithmetic T> constexpr T swap (T t)
         {
             if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 2)) {
                 return floating_point_swap<uint16_t> (t);
             }
-            if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 4)) {
+            else if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 4)) {
                 return floating_point_swap<uint32_t> (t);
             }
-            if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 8)) {
+            else if constexpr (std::is_floating_point_v<T> && (sizeof(T) == 8)) {
                 return floating_point_swap<uint64_t> (t);
             }
             else {
@@ -71,8 +72,17 @@ namespace little_deserialization_library
             }
         }
 
+        // Constant evaluation cannot write to an object through a pointer to its bytes, so the bytes are gathered in an array and bit_cast
         template<concepts::non_bool_arithmetic T, concepts::byte_like B> constexpr T read_no_swap (const B * src)
         {
+            if (std::is_constant_evaluated()) {
+                std::array<unsigned char, sizeof(T)> bytes{};
+                for (size_t i{0U}; i < sizeof(T); ++i) {
+                    bytes[i] = static_cast<unsigned char> (src[i]);
+                }
+                return std::bit_cast<T> (bytes);
+            }
+
             T val;
             std::copy (src, src + sizeof(T), std::bit_cast<B *> (std::addressof (val)));
 
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// The reasons why a non-throwing deserialization can fail.
+    /// </summary>
+    enum class error : uint8_t
+    {
+        not_enough_bytes = 1U
+    };
+
+    namespace result_helpers
+    {
+        // Converts to T by calling make, so that a result constructed with std::in_place from it holds the object returned by make,
+        // rather than a copy of it
+        template<typename T, typename F> struct deferred
+        {
+            F & make;
+
+            constexpr operator T (void) const { return make(); }
+        };
+    }
+
+    /// <summary>
+    /// The error-carrying alternative of a result, convertible to any result<T>.
+    /// </summary>
+    struct unexpected_error
+    {
+        error value;
+    };
+
+    /// <summary>
+    /// Constructs a result holding the error e.
+    /// </summary>
+    constexpr unexpected_error make_error (error e) noexcept { return unexpected_error{e}; }
+
+    /// <summary>
+    /// Either a value of type T or the error that prevented its deserialization; a subset of the interface of std::expected<T, error>.
+    /// It does not depend on the standard library providing std::expected, so that its definition is the same in every translation unit.
+    /// </summary>
+    template<typename T> class result
+    {
+    public:
+        template<typename U = T> requires(std::is_constructible_v<T, U &&>) constexpr result (U && value) : value_{std::forward<U> (value)} { }
+        template<typename... Args> constexpr explicit result (std::in_place_t, Args &&... args) : value_{std::in_place, std::forward<Args> (args)...} { }
+        constexpr result (unexpected_error e) noexcept : error_{e.value} { }
+
+        constexpr bool has_value (void) const noexcept { return value_.has_value(); }
+        constexpr explicit operator bool (void) const noexcept { return has_value(); }
+
+        constexpr T & value (void) & { return value_.value(); }
+        constexpr const T & value (void) const & { return value_.value(); }
+        constexpr T && value (void) && { return std::move (value_).value(); }
+        template<typename U> constexpr T value_or (U && fallback) const & { return value_.value_or (std::forward<U> (fallback)); }
+
+        constexpr T & operator* (void) & noexcept { return *value_; }
+        constexpr const T & operator* (void) const & noexcept { return *value_; }
+        constexpr T * operator-> (void) noexcept { return &*value_; }
+        constexpr const T * operator-> (void) const noexcept { return &*value_; }
+
+        constexpr little_deserialization_library::error error (void) const noexcept { return error_; }
+
+
+    private:
+        std::optional<T> value_;
+        little_deserialization_library::error error_{};
+    };
+
+    template<> class result<void>
+    {
+    public:
+        constexpr result (void) noexcept = default;
+        constexpr result (unexpected_error e) noexcept : error_{e.value} { }
+
+        constexpr bool has_value (void) const noexcept { return !error_.has_value(); }
+        constexpr explicit operator bool (void) const noexcept { return has_value(); }
+
+        constexpr little_deserialization_library::error error (void) const noexcept { return *error_; }
+
+
+    private:
+        std::optional<little_deserialization_library::error> error_;
+    };
+}
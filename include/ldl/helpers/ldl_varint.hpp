@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#include "ldl_concepts.hpp"
+#include "ldl_deserialization_rules.hpp"
+#include "ldl_isa.hpp"
+#include "ldl_reader.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// The number of values decoded by decode_varints or decode_zigzag_varints, and the number of bytes they took.
+    /// </summary>
+    struct varint_decode_result
+    {
+        size_t values;
+        size_t bytes;
+    };
+
+    namespace varint_helpers
+    {
+        /// <summary>
+        /// Name of the bit-compaction kernel selected at compile time: "bmi2" or "swar".
+        /// </summary>
+#if defined(__BMI2__)
+        inline constexpr const char * kernel_name{"bmi2"};
+#else
+        inline constexpr const char * kernel_name{"swar"};
+#endif
+
+        // The largest number of bytes of a varint that holds an unsigned integer of type U
+        template<typename U> inline constexpr size_t max_length{((8U * sizeof(U)) + 6U) / 7U};
+
+        inline constexpr uint64_t continuation_bits{0x8080808080808080U};
+        inline constexpr uint64_t payload_bits{0x7F7F7F7F7F7F7F7FU};
+
+        // The number of bytes of the varint at data, or std::numeric_limits<size_t>::max() if it does not end within "available" bytes,
+        // or within the largest length for U
+        template<typename U, concepts::byte_like B> constexpr size_t length (B * data, size_t available) noexcept
+        {
+            const auto last{std::min (available, max_length<U>)};
+            for (size_t i{0U}; i < last; ++i) {
+                if ((static_cast<uint8_t> (data[i]) & 0x80U) == 0U) {
+                    return i + 1U;
+                }
+            }
+            return std::numeric_limits<size_t>::max();
+        }
+
+        // Decodes the varint at data, one byte at a time; bits past the width of U are dropped
+        template<typename U, concepts::byte_like B> constexpr U decode (B * data) noexcept
+        {
+            U value{0U};
+            for (size_t i{0U}; i < max_length<U>; ++i) {
+                const auto byte{static_cast<uint8_t> (data[i])};
+                value = static_cast<U> (value | (static_cast<U> (byte & 0x7FU) << (7U * i)));
+                if ((byte & 0x80U) == 0U) {
+                    break;
+                }
+            }
+            return value;
+        }
+
+        template<std::unsigned_integral U> constexpr std::make_signed_t<U> unzigzag (U value) noexcept
+        {
+            return static_cast<std::make_signed_t<U>> ((value >> 1U) ^ (U{0U} - (value & 1U)));
+        }
+
+        // Decodes the value of a varint or zigzag element at data
+        template<concepts::varint_element T, concepts::byte_like B> constexpr T value_at (B * data) noexcept
+        {
+            using V = T::value_type;
+            if constexpr (std::is_signed_v<V>) {
+                return T{unzigzag (decode<std::make_unsigned_t<V>> (data))};
+            }
+            else {
+                return T{decode<V> (data)};
+            }
+        }
+
+        // Gathers the seven payload bits of the first "length" bytes of a little-endian word, 1 <= length <= 8, without a loop
+        inline uint64_t compact (uint64_t word, size_t length) noexcept
+        {
+            const auto payload{payload_bits & (~uint64_t{0U} >> (64U - (8U * length)))};
+#if defined(__BMI2__)
+            return _pext_u64 (word, payload);
+#else
+            // Pairs of 7-bit groups, then of 14-bit groups, then of 28-bit groups are joined in place
+            auto value{word & payload};
+            value = (value & 0x007F007F007F007FU) | ((value & 0x7F007F007F007F00U) >> 1U);
+            value = (value & 0x00003FFF00003FFFU) | ((value & 0x3FFF00003FFF0000U) >> 2U);
+            return (value & 0x000000000FFFFFFFU) | ((value & 0x0FFFFFFF00000000U) >> 4U);
+#endif
+        }
+
+        // One bit per byte of a little-endian word, set for the last byte of a varint, i.e. a byte whose continuation bit is cleared
+        inline uint8_t end_mask (uint64_t word) noexcept
+        {
+#if defined(__BMI2__)
+            return static_cast<uint8_t> (_pext_u64 (~word, continuation_bits));
+#else
+            // The multiplication moves the bit of the i-th byte to bit 56 + i
+            return static_cast<uint8_t> ((((~word & continuation_bits) >> 7U) * 0x0102040810204080U) >> 56U);
+#endif
+        }
+
+        // Decodes back-to-back varints into out, stopping at the first truncated or overlong one, and calls "convert" on every decoded value.
+        // Runs of 16 one-byte varints, or 8 two-byte varints, are recognized from their continuation bits alone; otherwise, the ends of all
+        // the varints in a window of 64 bytes are found at once, and every varint of up to 8 bytes is decoded from a load
+        // at its start, so that the loads do not wait for each other. Longer varints, and the last bytes of the buffer, are read one byte at a time
+        template<typename U, concepts::byte_like B, typename T, typename F> varint_decode_result decode (B * data, size_t size, std::span<T> out,
+                                                                                                       const F & convert) noexcept
+        {
+            constexpr uint64_t two_byte_pattern{0x0080008000800080U};
+            constexpr auto longest_loaded{std::min<size_t> (sizeof(uint64_t), max_length<U>)};
+            // The bytes whose continuation bits are gathered into one mask, so that the loop over the varints that end in them seldom exits
+            constexpr size_t window{64U};
+
+            size_t read{0U};
+            size_t count{0U};
+            while (count < out.size()) {
+                const auto available{size - read};
+                // A varint that ends in the window can be loaded from its start
+                if (available >= (window + sizeof(uint64_t))) {
+                    const auto word{reader::read<uint64_t, std::endian::little> (data + read)};
+                    const auto next{reader::read<uint64_t, std::endian::little> (data + read + 8U)};
+                    if ((out.size() - count) >= 16U) {
+                        if (((word | next) & continuation_bits) == 0U) {
+                            for (size_t i{0U}; i < 16U; ++i) {
+                                out[count + i] = convert (static_cast<U> (static_cast<uint8_t> (data[read + i])));
+                            }
+                            count += 16U;
+                            read += 16U;
+                            continue;
+                        }
+                        if constexpr (max_length<U> >= 2U) {
+                            if (((word & continuation_bits) == two_byte_pattern) && ((next & continuation_bits) == two_byte_pattern)) {
+                                // Every 16-bit lane holds one varint: its high byte moves down by one bit over the cleared continuation bit
+                                const auto low{(word & 0x007F007F007F007FU) | ((word >> 1U) & 0x3F803F803F803F80U)};
+                                const auto high{(next & 0x007F007F007F007FU) | ((next >> 1U) & 0x3F803F803F803F80U)};
+                                for (size_t i{0U}; i < 4U; ++i) {
+                                    out[count + i] = convert (static_cast<U> (static_cast<uint16_t> (low >> (16U * i))));
+                                    out[count + 4U + i] = convert (static_cast<U> (static_cast<uint16_t> (high >> (16U * i))));
+                                }
+                                count += 8U;
+                                read += 16U;
+                                continue;
+                            }
+                        }
+                    }
+
+                    uint64_t ends{end_mask (word) | (uint64_t{end_mask (next)} << 8U)};
+                    for (size_t i{2U}; i < (window / sizeof(uint64_t)); ++i) {
+                        ends |= uint64_t{end_mask (reader::read<uint64_t, std::endian::little> (data + read + (8U * i)))} << (8U * i);
+                    }
+
+                    size_t start{0U};
+                    for (; (ends != 0U) && (count < out.size()); ends &= ends - 1U) {
+                        const auto end{static_cast<size_t> (std::countr_zero (ends))};
+                        if ((end + 1U - start) > longest_loaded) {
+                            break;
+                        }
+                        out[count++] = convert (static_cast<U> (compact (reader::read<uint64_t, std::endian::little> (data + read + start), end + 1U - start)));
+                        start = end + 1U;
+                    }
+                    if (start != 0U) {
+                        read += start;
+                        continue;
+                    }
+                }
+
+                const auto varint_length{length<U> (data + read, available)};
+                if (varint_length > available) {
+                    break;
+                }
+                out[count++] = convert (decode<U> (data + read));
+                read += varint_length;
+            }
+
+            return {count, read};
+        }
+    }
+
+    /// <summary>
+    /// Decodes back-to-back LEB128 varints from "bytes" into out, until out is full, or the next varint is truncated or longer than
+    /// (8 * sizeof(U) + 6) / 7 bytes. Instead of a loop over the bytes of every varint, the continuation bits of the next 16 bytes first tell
+    /// runs of one-byte and two-byte varints, decoded 16 and 8 at a time. Otherwise, the continuation bits of a 64-byte window give the ends
+    /// of all the varints in it, whose payload bits are then gathered from a load at their start, without a loop (with pext where BMI2 is available).
+    /// </summary>
+    /// <typeparam name="U">The unsigned type of the values</typeparam>
+    /// <param name="bytes">The buffer that holds the varints</param>
+    /// <param name="out">The decoded values, in the order in which they are in the buffer</param>
+    /// <returns>The number of values decoded, at the front of out, and the number of bytes they took, at the front of "bytes"</returns>
+    template<typename U, concepts::byte_like B, size_t N> requires(std::unsigned_integral<U> && !std::is_same_v<U, bool>)
+    varint_decode_result decode_varints (std::span<B, N> bytes, std::span<U> out) noexcept
+    {
+        return varint_helpers::decode<U> (bytes.data(), bytes.size(), out, [] (U value) noexcept { return value; });
+    }
+
+    /// <summary>
+    /// Decodes back-to-back zigzag-encoded varints from "bytes" into out, as decode_varints does, and maps them back to signed values.
+    /// </summary>
+    /// <typeparam name="S">The signed type of the values</typeparam>
+    /// <param name="bytes">The buffer that holds the varints</param>
+    /// <param name="out">The decoded values, in the order in which they are in the buffer</param>
+    /// <returns>The number of values decoded, at the front of out, and the number of bytes they took, at the front of "bytes"</returns>
+    template<std::signed_integral S, concepts::byte_like B, size_t N> varint_decode_result decode_zigzag_varints (std::span<B, N> bytes, std::span<S> out) noexcept
+    {
+        using U = std::make_unsigned_t<S>;
+        return varint_helpers::decode<U> (bytes.data(), bytes.size(), out, [] (U value) noexcept { return varint_helpers::unzigzag (value); });
+    }
+}
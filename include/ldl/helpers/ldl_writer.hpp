@@ -0,0 +1,28 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <type_traits>
+
+#include "ldl_concepts.hpp"
+#include "ldl_isa.hpp"
+#include "ldl_reader.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace writer
+    {
+        template<concepts::non_bool_arithmetic T, std::endian E = std::endian::big, concepts::byte_like B> constexpr void write (B * dst, T val)
+        {
+            static_assert(!std::is_const_v<B>, "cannot write to const bytes");
+
+            if constexpr ((std::endian::native != E) && concepts::swappable_arithmetic<T>) {
+                val = reader_helpers::swap (val);
+            }
+            const auto bytes{std::bit_cast<std::array<unsigned char, sizeof(T)>> (val)};
+            std::transform (bytes.begin(), bytes.end(), dst, [] (unsigned char byte) { return static_cast<B> (byte); });
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "chunked_deserializer.hpp"
+#include "helpers/ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// Deserializes a sequence of objects of types Ts... from input that arrives in pieces, e.g. from a stream socket.
+    /// Bytes are fed as they arrive; every object is decoded as soon as its last byte is fed, and is kept until reset() is called.
+    /// Objects that lie entirely in one piece are deserialized in place; once an object is split across pieces, the bytes from there on are copied,
+    /// once, into a buffer held by the parser, so that every fed byte is read a bounded number of times.
+    /// </summary>
+    /// <typeparam name="E">The endianness of the serialized objects</typeparam>
+    /// <typeparam name="Ts">The types of the objects, in the order in which they are serialized</typeparam>
+    template<std::endian E, concepts::self_contained... Ts> requires (sizeof...(Ts) > 0U) class incremental_parser
+    {
+    public:
+        /// <summary>
+        /// Consumes bytes from the input until either the input is exhausted, or all the objects have been decoded.
+        /// </summary>
+        /// <param name="bytes">The next piece of input</param>
+        /// <returns>The number of bytes consumed; bytes past it belong to whatever follows the objects</returns>
+        template<concepts::byte_like B, size_t N> size_t feed (std::span<B, N> bytes) noexcept;
+
+        /// <summary>
+        /// Whether all the objects have been decoded.
+        /// </summary>
+        constexpr bool done (void) const noexcept { return decoded_ == sizeof...(Ts); }
+        /// <summary>
+        /// Returns the number of objects decoded so far.
+        /// </summary>
+        constexpr size_t decoded (void) const noexcept { return decoded_; }
+        /// <summary>
+        /// Returns the number of bytes still to be fed to decode all the objects.
+        /// </summary>
+        constexpr size_t missing (void) const noexcept
+        { return total_length - fed_; }
+
+        /// <summary>
+        /// Returns the I-th object. The behavior is undefined if the object has not been decoded yet, i.e. if decoded() is not greater than I.
+        /// </summary>
+        /// <typeparam name="I">The position of the object in Ts...</typeparam>
+        template<size_t I> constexpr const auto & get (void) const noexcept { return *std::get<I> (objects_); }
+
+        /// <summary>
+        /// Discards the decoded objects and the buffered bytes, to parse a new sequence of objects.
+        /// </summary>
+        constexpr void reset (void) noexcept
+        {
+            decoded_ = 0U;
+            fed_ = 0U;
+        }
+
+    private:
+        static constexpr std::array<size_t, sizeof...(Ts)> lengths{deserialization_length<Ts>()...};
+        static constexpr size_t total_length{(deserialization_length<Ts>() + ...)};
+        // The position of every object in the sequence
+        static constexpr auto offsets{[] {
+            std::array<size_t, sizeof...(Ts)> offsets{};
+            std::exclusive_scan (lengths.begin(), lengths.end(), offsets.begin(), size_t{0U});
+            return offsets;
+        } ()};
+
+        // Decodes the next object from data, which holds all its bytes
+        template<concepts::byte_like B> constexpr void decode_next (B * data) noexcept
+        {
+            [this, data] <size_t... Idx> (std::index_sequence<Idx...>) {
+                (void) ((decoded_ == Idx ? (std::get<Idx> (objects_).emplace (deserialize_at<Ts, E> (data)), true) : false) || ...);
+            } (std::index_sequence_for<Ts...>());
+            ++decoded_;
+        }
+
+        std::tuple<std::optional<Ts>...> objects_;
+        std::array<uint8_t, total_length> buffer_;
+        size_t decoded_{0U};
+        // The number of bytes fed so far
+        size_t fed_{0U};
+    };
+
+    template<typename... Ts> using network_packet_parser = incremental_parser<std::endian::big, Ts...>;
+
+
+    template<std::endian E, concepts::self_contained... Ts> requires (sizeof...(Ts) > 0U)
+    template<concepts::byte_like B, size_t N> inline size_t incremental_parser<E, Ts...>::feed (std::span<B, N> bytes) noexcept
+    {
+        size_t consumed{0U};
+        // Objects that lie entirely in the input are deserialized in place
+        while (!done() && (fed_ == offsets[decoded_]) && ((bytes.size() - consumed) >= lengths[decoded_])) {
+            decode_next (bytes.data() + consumed);
+            consumed += lengths[decoded_ - 1U];
+            fed_ += lengths[decoded_ - 1U];
+        }
+
+        // The rest of the input is copied at its position in the sequence of objects, and the objects it completes are deserialized from there
+        if (!done()) {
+            const auto count{std::min (total_length - fed_, bytes.size() - consumed)};
+            std::memcpy (buffer_.data() + fed_, bytes.data() + consumed, count);
+            fed_ += count;
+            consumed += count;
+            while (!done() && ((offsets[decoded_] + lengths[decoded_]) <= fed_)) {
+                decode_next (static_cast<const uint8_t *> (buffer_.data() + offsets[decoded_]));
+            }
+        }
+
+        return consumed;
+    }
+}
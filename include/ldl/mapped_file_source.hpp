@@ -0,0 +1,110 @@
+#pragma once
+
+#if __has_include(<sys/mman.h>)
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "helpers/ldl_isa.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// Maps a whole file in memory, read only, and advises the kernel that it will be read sequentially, with transparent huge pages where supported.
+    /// The mapping is released when the object is destroyed; spans obtained through bytes() must not outlive it.
+    /// Available on POSIX systems only.
+    /// </summary>
+    class mapped_file_source
+    {
+    public:
+        /// <summary>
+        /// Maps the file at the specified path. Throws a std::system_error if the file cannot be opened or mapped.
+        /// </summary>
+        /// <param name="path">The path of the file to map</param>
+        explicit mapped_file_source (const std::filesystem::path & path);
+        ~mapped_file_source();
+
+        mapped_file_source (const mapped_file_source &) = delete;
+        mapped_file_source & operator= (const mapped_file_source &) = delete;
+        mapped_file_source (mapped_file_source && other) noexcept
+            : data_{std::exchange (other.data_, nullptr)}, size_{std::exchange (other.size_, 0U)}
+        { }
+        mapped_file_source & operator= (mapped_file_source && other) noexcept
+        {
+            std::swap (data_, other.data_);
+            std::swap (size_, other.size_);
+            return *this;
+        }
+
+        /// <summary>
+        /// Returns a std::span over the contents of the file.
+        /// </summary>
+        std::span<const uint8_t> bytes (void) const noexcept { return {data_, size_}; }
+        /// <summary>
+        /// Returns the size of the file, in bytes.
+        /// </summary>
+        size_t size (void) const noexcept { return size_; }
+
+    private:
+        const uint8_t * data_{nullptr};
+        size_t size_{0U};
+    };
+
+
+    inline mapped_file_source::mapped_file_source (const std::filesystem::path & path)
+    {
+        const auto fd{::open (path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd < 0) {
+            throw std::system_error{errno, std::generic_category(), "cannot open " + path.string()};
+        }
+
+        struct ::stat status{};
+        if (::fstat (fd, &status) != 0) {
+            const auto error{errno};
+            ::close (fd);
+            throw std::system_error{error, std::generic_category(), "cannot read the size of " + path.string()};
+        }
+
+        // Empty files cannot be mapped, and need no mapping
+        size_ = static_cast<size_t> (status.st_size);
+        if (size_ > 0U) {
+            const auto address{::mmap (nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0)};
+            if (address == MAP_FAILED) {
+                const auto error{errno};
+                ::close (fd);
+                throw std::system_error{error, std::generic_category(), "cannot map " + path.string()};
+            }
+            data_ = static_cast<const uint8_t *> (address);
+
+            // Both are hints: failures are ignored
+            (void) ::madvise (address, size_, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+            (void) ::madvise (address, size_, MADV_HUGEPAGE);
+#endif
+        }
+
+        // The mapping holds its own reference to the file
+        ::close (fd);
+    }
+
+    inline mapped_file_source::~mapped_file_source()
+    {
+        if (data_ != nullptr) {
+            ::munmap (const_cast<uint8_t *> (data_), size_);
+        }
+    }
+}
+
+#endif
@@ -1,29 +1,51 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <bit>
 #include <format>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "helpers/ldl_array_view.hpp"
+#include "helpers/ldl_bit_unpacker.hpp"
+#include "helpers/ldl_bulk_reader.hpp"
 #include "helpers/ldl_concepts.hpp"
 #include "helpers/ldl_deserialization_rules.hpp"
+#include "helpers/ldl_dispatch.hpp"
+#include "helpers/ldl_isa.hpp"
 #include "helpers/ldl_reader.hpp"
+#include "helpers/ldl_result.hpp"
+#include "helpers/ldl_varint.hpp"
 
 
-namespace little_deserialization_library
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
 {
     template<typename T> consteval size_t deserialization_length (void);
     template<typename T, std::endian E, concepts::byte_like B> requires(!concepts::is_any_array<T>) constexpr T deserialize (std::span<B> & packet);
     template<concepts::is_any_array T, std::endian E, concepts::byte_like B> constexpr auto deserialize (std::span<B> & packet);
+    template<typename T, std::endian E, concepts::byte_like B> constexpr auto deserialize_at (B * data, std::pmr::memory_resource * resource = nullptr);
+    template<typename T, std::endian E, concepts::byte_like B> constexpr size_t deserialization_length_at (B * data, size_t available);
+    template<typename Tuple, std::endian E, concepts::byte_like B> constexpr auto element_offsets (B * data, size_t available);
+    template<typename A, std::endian E, concepts::byte_like B>
+        typename A::value_type deserialize_alternative_at (B * data, size_t alternative, std::pmr::memory_resource * resource = nullptr);
+    template<typename T, std::endian E, concepts::byte_like B, std::output_iterator<T> O> constexpr O deserialize_n (std::span<B> & packet, size_t count, O out);
 
     template<typename A> consteval auto array_size (void)
     {
         if constexpr (concepts::is_std_array<A>) {
             return std::tuple_size_v<A>;
         }
-        else if constexpr (concepts::is_bounded_byte_array<A>) {
+        else if constexpr (std::is_bounded_array_v<A>) {
             return std::extent_v<A>;
         }
         else {
@@ -31,6 +53,8 @@ namespace little_deserialization_library
         }
     }
 
+    template<typename A> using array_element_t = std::remove_cvref_t<decltype(std::declval<A &>()[0])>;
+
     template<typename Tuple, size_t... Idx> constexpr size_t deserialization_length_from_tuple_impl (std::index_sequence<Idx...>)
     {
         return (deserialization_length<std::tuple_element_t<Idx, Tuple>>() + ...);
@@ -42,66 +66,749 @@ namespace little_deserialization_library
         return deserialization_length_from_tuple_impl<Tuple> (std::make_index_sequence<tuple_size>());
     }
 
-    template<typename T, typename Tuple, std::endian E, concepts::byte_like B, size_t... Idx>
-        constexpr T construct_from_tuple_impl (std::span<B> & packet, std::index_sequence<Idx...>)
+    template<typename Tuple, size_t I> consteval size_t deserialization_offset (void)
+    {
+        return [] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return (size_t{0U} + ... + deserialization_length<std::tuple_element_t<Idx, Tuple>>());
+        } (std::make_index_sequence<I>());
+    }
+
+    template<typename T> consteval bool has_dynamic_length (void);
+
+    template<typename Tuple> consteval bool tuple_has_dynamic_length (void)
+    {
+        return [] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return (false || ... || has_dynamic_length<std::tuple_element_t<Idx, Tuple>>());
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+    }
+
+    // Whether the number of bytes read to deserialize an object of type T depends on length fields in the buffer
+    template<typename T> consteval bool has_dynamic_length (void)
+    {
+        if constexpr (concepts::dynamic_element<T>) {
+            return true;
+        }
+        else if constexpr (concepts::ruled<T>) {
+            return tuple_has_dynamic_length<deserialization_rules::rule_t<T>>();
+        }
+        else {
+            return false;
+        }
+    }
+
+    template<typename T> consteval bool allocates (void);
+
+    template<typename Tuple> consteval bool tuple_allocates (void)
+    {
+        return [] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return (false || ... || allocates<std::tuple_element_t<Idx, Tuple>>());
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+    }
+
+    // Whether deserializing an object of type T allocates the std::pmr::vector of a repeated element, in T or in one of its alternatives
+    template<typename T> consteval bool allocates (void)
+    {
+        if constexpr (is_repeated<T>::value) {
+            return true;
+        }
+        else if constexpr (is_variant_on<T>::value) {
+            return [] <size_t... Alts> (std::index_sequence<Alts...>) {
+                return (false || ... || allocates<typename T::template alternative_t<Alts + 1U>>());
+            } (std::make_index_sequence<T::size()>());
+        }
+        else if constexpr (concepts::ruled<T>) {
+            return tuple_allocates<deserialization_rules::rule_t<T>>();
+        }
+        else {
+            return false;
+        }
+    }
+
+    namespace concepts
+    {
+        /// <summary>
+        /// Requires that the number of bytes read to deserialize an object of type T is known at compile time,
+        /// i.e. that neither T nor its deserialization rule contain length_prefixed, sized_by, variant_on, or repeated elements.
+        /// </summary>
+        template<typename T> concept fixed_length = !has_dynamic_length<T>();
+
+        /// <summary>
+        /// Requires that deserializing an object of type T does not allocate memory,
+        /// i.e. that neither T, nor its deserialization rule, nor the alternatives of its variant_on elements contain repeated elements.
+        /// </summary>
+        template<typename T> concept non_allocating = !allocates<T>();
+    }
+
+    // The offsets of the elements of a rule of fixed length, which are computed at compile time
+    template<typename Tuple> struct constant_offsets { };
+
+    template<typename Tuple, size_t I, typename O> constexpr size_t element_offset (const O & offsets)
+    {
+        if constexpr (std::is_same_v<O, constant_offsets<Tuple>>) {
+            return deserialization_offset<Tuple, I>();
+        }
+        else {
+            return offsets[I];
+        }
+    }
+
+    // The number of constructor arguments produced by a rule element: none for skipped elements, one per field for bit fields
+    template<typename F> consteval size_t argument_count (void)
+    {
+        if constexpr (concepts::skipped_element<F>) {
+            return 0U;
+        }
+        else if constexpr (concepts::bit_fields<F>) {
+            return F::size();
+        }
+        else {
+            return 1U;
+        }
+    }
+
+    // A constructor argument produced by a rule: the index of the rule element, and the index of the bit field within it
+    struct rule_argument
+    {
+        size_t element;
+        size_t part;
+    };
+
+    template<typename Tuple> consteval auto rule_arguments (void)
+    {
+        constexpr auto count{[] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return (size_t{0U} + ... + argument_count<std::tuple_element_t<Idx, Tuple>>());
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>())};
+
+        std::array<rule_argument, count> arguments{};
+        size_t next{0U};
+        [&arguments, &next] <size_t... Idx> (std::index_sequence<Idx...>) {
+            ((void) [&arguments, &next] {
+                for (size_t part{0U}; part < argument_count<std::tuple_element_t<Idx, Tuple>>(); ++part) {
+                    arguments[next++] = rule_argument{Idx, part};
+                }
+            } (), ...);
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+
+        return arguments;
+    }
+
+    namespace repeated_helpers
+    {
+        template<typename F> consteval size_t record_length (void)
+        {
+            using T = F::value_type;
+            static_assert(concepts::fixed_length<T>, "the records of repeated must have a length known at compile time");
+            static_assert(deserialization_length<T>() > 0U, "the records of repeated must not be empty");
+            return deserialization_length<T>();
+        }
+
+        // The records in "length" bytes starting at data, in a vector whose capacity is allocated once from resource, or from the default memory resource
+        template<typename F, std::endian E, concepts::byte_like B>
+            std::pmr::vector<typename F::value_type> records_at (B * data, size_t length, std::pmr::memory_resource * resource)
+        {
+            using T = F::value_type;
+            constexpr auto record_length{repeated_helpers::record_length<F>()};
+            const auto count{length / record_length};
+
+            std::pmr::vector<T> records{(resource != nullptr) ? resource : std::pmr::get_default_resource()};
+            records.reserve (count);
+            for (size_t i{0U}; i < count; ++i) {
+                records.push_back (static_cast<T> (deserialize_at<T, E> (data + (i * record_length))));
+            }
+
+            return records;
+        }
+    }
+
+    template<typename Tuple, size_t K> using argument_element_t = std::tuple_element_t<rule_arguments<Tuple>()[K].element, Tuple>;
+
+    template<typename Tuple, size_t K, typename B> struct argument_type
+    {
+        using type = argument_element_t<Tuple, K>;
+    };
+    template<typename Tuple, size_t K, typename B> requires(concepts::bit_fields<argument_element_t<Tuple, K>>) struct argument_type<Tuple, K, B>
+    {
+        using type = argument_element_t<Tuple, K>::template field_type<rule_arguments<Tuple>()[K].part>;
+    };
+    template<typename Tuple, size_t K, typename B>
+        requires(is_length_prefixed<argument_element_t<Tuple, K>>::value || is_sized_by<argument_element_t<Tuple, K>>::value) struct argument_type<Tuple, K, B>
+    {
+        using type = bytes_view<B>;
+    };
+    template<typename Tuple, size_t K, typename B> requires(is_variant_on<argument_element_t<Tuple, K>>::value) struct argument_type<Tuple, K, B>
+    {
+        using type = argument_element_t<Tuple, K>::value_type;
+    };
+    template<typename Tuple, size_t K, typename B> requires(is_repeated<argument_element_t<Tuple, K>>::value) struct argument_type<Tuple, K, B>
+    {
+        using type = std::pmr::vector<typename argument_element_t<Tuple, K>::value_type>;
+    };
+    template<typename Tuple, size_t K, typename B> requires(concepts::packed_array_element<argument_element_t<Tuple, K>>) struct argument_type<Tuple, K, B>
+    {
+        using type = argument_element_t<Tuple, K>::array_type;
+    };
+    template<typename Tuple, size_t K, typename B> requires(concepts::varint_element<argument_element_t<Tuple, K>>) struct argument_type<Tuple, K, B>
+    {
+        using type = argument_element_t<Tuple, K>::value_type;
+    };
+    template<typename Tuple, size_t K, typename B> using argument_t = argument_type<Tuple, K, B>::type;
+
+    // The K-th constructor argument produced by a rule; every bit field of an element is extracted from the same load of its word
+    template<typename Tuple, size_t K, std::endian E, concepts::byte_like B, typename O>
+        constexpr auto argument_at (B * data, const O & offsets, std::pmr::memory_resource * resource)
+    {
+        constexpr auto argument{rule_arguments<Tuple>()[K]};
+        using F = std::tuple_element_t<argument.element, Tuple>;
+        const auto field{data + element_offset<Tuple, argument.element> (offsets)};
+
+        if constexpr (concepts::bit_fields<F>) {
+            return deserialize_at<F, E> (field).template get<argument.part>();
+        }
+        else if constexpr (is_sized_by<F>::value) {
+            return bytes_view<B>{std::span<B>{field, offsets[argument.element + 1U] - offsets[argument.element]}};
+        }
+        else if constexpr (is_repeated<F>::value) {
+            return repeated_helpers::records_at<F, E> (field, offsets[argument.element + 1U] - offsets[argument.element], resource);
+        }
+        else if constexpr (is_variant_on<F>::value) {
+            const auto key{deserialize_at<std::tuple_element_t<F::index, Tuple>, E> (data + offsets[F::index])};
+            return deserialize_alternative_at<F, E> (field, F::find (static_cast<uint64_t> (key)), resource);
+        }
+        else {
+            return deserialize_at<F, E> (field, resource);
+        }
+    }
+
+    // Every field is read at its own offset from data, so that the reads do not depend on each other; skipped elements are not read
+    template<typename T, typename Tuple, std::endian E, concepts::byte_like B, typename O, size_t... Ks>
+        constexpr T construct_from_tuple_impl (B * data, const O & offsets, std::pmr::memory_resource * resource, std::index_sequence<Ks...>)
+    {
+        static_assert(concepts::aggregate_constructible<T, argument_t<Tuple, Ks, B>...>, "Invalid deserialization rule");
+        return T{static_cast<to_array_ref_t<argument_t<Tuple, Ks, B>>>(argument_at<Tuple, Ks, E> (data, offsets, resource))...};
+    }
+
+    // The std::pmr::vector of every repeated element, nested ones included, is drawn from resource, or from the default memory resource if it is null
+    template<typename T, typename Tuple, std::endian E, concepts::byte_like B, typename O>
+        constexpr T construct_from_offsets (B * data, const O & offsets, std::pmr::memory_resource * resource = nullptr)
+    {
+        return construct_from_tuple_impl<T, Tuple, E> (data, offsets, resource, std::make_index_sequence<rule_arguments<Tuple>().size()>());
+    }
+
+    // Offsets are computed at compile time, unless the rule contains elements whose length is read from the buffer
+    template<typename T, typename Tuple, std::endian E, concepts::byte_like B> constexpr T construct_from_tuple_at (B * data, std::pmr::memory_resource * resource)
     {
-        static_assert(concepts::aggregate_constructible<T, std::tuple_element_t<Idx, Tuple>...>, "Invalid deserialization rule");
-        return T{static_cast<to_array_ref_t<std::tuple_element_t<Idx, Tuple>>>(deserialize<std::tuple_element_t<Idx, Tuple>, E> (packet))...};
+        if constexpr (tuple_has_dynamic_length<Tuple>()) {
+            return construct_from_offsets<T, Tuple, E> (data, element_offsets<Tuple, E> (data, std::numeric_limits<size_t>::max()), resource);
+        }
+        else {
+            return construct_from_offsets<T, Tuple, E> (data, constant_offsets<Tuple>{}, resource);
+        }
     }
 
     template<typename T, typename Tuple, std::endian E, concepts::byte_like B> constexpr T construct_from_tuple (std::span<B> & packet)
     {
-        constexpr auto tuple_size{std::tuple_size_v<Tuple>};
-        return construct_from_tuple_impl<T, Tuple, E> (packet, std::make_index_sequence<tuple_size>());
+        const auto data{packet.data()};
+        packet = packet.template subspan<deserialization_length_from_tuple<Tuple>()>();
+
+        return construct_from_tuple_at<T, Tuple, E> (data, nullptr);
+    }
+
+    template<typename Tuple> struct is_plain_rule : std::false_type { };
+    template<typename... Es> struct is_plain_rule<std::tuple<Es...>>
+    {
+        static constexpr bool value{(concepts::plain_rule_element<Es> && ...)};
+    };
+
+    template<typename T, typename Tuple> struct is_brace_initializable_from_tuple : std::false_type { };
+    template<typename T, typename... Es> struct is_brace_initializable_from_tuple<T, std::tuple<Es...>>
+    {
+        static constexpr bool value{requires { T{std::declval<Es>()...}; }};
+    };
+
+    namespace concepts
+    {
+        /// <summary>
+        /// Requires that the in-memory layout of T matches its wire layout: T is a trivially copyable, standard-layout aggregate without padding,
+        /// and its deserialization rule lists arithmetic types and std::arrays of arithmetic types that initialize its members in order, without narrowing.
+        /// Objects of such types are deserialized with a single copy of their bytes, followed by the endian conversion of their multi-byte fields.
+        /// </summary>
+        template<typename T> concept memcpy_deserializable = std::is_aggregate_v<T> && std::is_trivially_copyable_v<T> &&
+                                                             std::is_trivially_default_constructible_v<T> && std::is_standard_layout_v<T> &&
+                                                             is_plain_rule<deserialization_rules::rule_t<T>>::value &&
+                                                             (sizeof(T) == deserialization_length<T>()) &&
+                                                             is_brace_initializable_from_tuple<T, deserialization_rules::rule_t<T>>::value;
+    }
+
+    template<typename E> consteval size_t swap_unit_size (void)
+    {
+        if constexpr (concepts::is_std_array<E>) {
+            return sizeof(std::tuple_element_t<0, E>);
+        }
+        else {
+            return sizeof(E);
+        }
+    }
+
+    template<typename E> consteval size_t swap_unit_count (void)
+    {
+        return deserialization_length<E>() / swap_unit_size<E>();
+    }
+
+    // The multi-byte fields of a plain rule, in the order they appear on the wire; an array field is a single run of elements
+    template<typename Tuple> consteval auto swap_units (void)
+    {
+        constexpr auto count{[] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return (size_t{0U} + ... + ((swap_unit_size<std::tuple_element_t<Idx, Tuple>>() > 1U) ? 1U : 0U));
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>())};
+
+        std::array<bulk_reader_helpers::swap_unit, count> units{};
+        size_t next{0U};
+        [&units, &next] <size_t... Idx> (std::index_sequence<Idx...>) {
+            ([&units, &next] {
+                using F = std::tuple_element_t<Idx, Tuple>;
+                if constexpr (swap_unit_size<F>() > 1U) {
+                    units[next++] = bulk_reader_helpers::swap_unit{deserialization_offset<Tuple, Idx>(), swap_unit_size<F>(), swap_unit_count<F>()};
+                }
+            } (), ...);
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+
+        return units;
+    }
+
+    template<concepts::memcpy_deserializable T, std::endian E, concepts::byte_like B> T memcpy_deserialize (const B * src) noexcept
+    {
+        T value;
+        std::memcpy (&value, src, sizeof(T));
+        if constexpr (std::endian::native != E) {
+            bulk_reader_helpers::swap_units<sizeof(T), swap_units<deserialization_rules::rule_t<T>>()> (reinterpret_cast<unsigned char *> (&value));
+        }
+
+        return value;
     }
 
+    template<typename T> struct skipped_length;
+    template<size_t N> struct skipped_length<skip<N>> : std::integral_constant<size_t, N> { };
+    template<typename T> struct skipped_length<ignore<T>> : std::integral_constant<size_t, deserialization_length<T>()>
+    {
+        static_assert(!has_dynamic_length<T>(), "cannot ignore an object whose length is read from the buffer");
+    };
+
     template<typename T> consteval size_t deserialization_length (void)
     {
         if constexpr (concepts::non_bool_arithmetic<T>) {
             return sizeof(T);
         }
+        else if constexpr (concepts::is_swappable_array<T>) {
+            return array_size<T>() * sizeof(array_element_t<T>);
+        }
         else if constexpr (concepts::is_any_array<T>) {
             return array_size<T>();
         }
         else if constexpr (concepts::is_static_extent_byte_span<T>) {
             return T::extent;
         }
+        else if constexpr (concepts::skipped_element<T>) {
+            return skipped_length<T>::value;
+        }
+        else if constexpr (concepts::bit_fields<T>) {
+            return sizeof(T::word);
+        }
+        else if constexpr (concepts::packed_array_element<T>) {
+            return bit_unpacker::packed_length<T::bits> (std::tuple_size_v<typename T::array_type>);
+        }
+        else if constexpr (is_length_prefixed<T>::value) {
+            return sizeof(typename T::length_type);
+        }
+        else if constexpr (concepts::varint_element<T>) {
+            return 1U;
+        }
+        else if constexpr (is_sized_by<T>::value || is_variant_on<T>::value || is_repeated<T>::value) {
+            return 0U;
+        }
         else {
             return deserialization_length_from_tuple<deserialization_rules::rule_t<T>>();
         }
     }
 
-    template<typename T, std::endian E, concepts::byte_like B> requires(!concepts::is_any_array<T>) constexpr T deserialize (std::span<B> & packet)
+    /// <summary>
+    /// Deserializes an object of type T from the bytes starting at data, without bounds checks.
+    /// The fields of user-defined types are read at offsets computed at compile time, rather than by advancing a std::span field by field.
+    /// The std::pmr::vector of every repeated element is drawn from resource, or from the default memory resource if it is null.
+    /// </summary>
+    template<typename T, std::endian E, concepts::byte_like B> constexpr auto deserialize_at (B * data, std::pmr::memory_resource * resource)
     {
         if constexpr (concepts::non_bool_arithmetic<T>) {
-            const auto value{reader::read<T, E> (packet.data())};
-            packet = packet.template subspan<sizeof(T)>();
-
-            return value;
+            return reader::read<T, E> (data);
+        }
+        else if constexpr (concepts::skipped_element<T>) {
+            return T{};
+        }
+        else if constexpr (concepts::bit_fields<T>) {
+            return T{reader::read<decltype(T::word), E> (data)};
+        }
+        else if constexpr (concepts::packed_array_element<T>) {
+            T packed;
+            bit_unpacker::unpack<T::bits, E> (data, packed.values.data(), packed.values.size());
+            return packed;
+        }
+        else if constexpr (concepts::varint_element<T>) {
+            return varint_helpers::value_at<T> (data);
+        }
+        else if constexpr (concepts::dynamic_element<T>) {
+            static_assert(is_length_prefixed<T>::value, "sized_by, variant_on, and repeated can only be deserialized as elements of a deserialization rule");
+            using L = T::length_type;
+            return bytes_view<B>{std::span<B>{data + sizeof(L), static_cast<size_t> (reader::read<L, E> (data))}};
         }
         else if constexpr (concepts::is_static_extent_byte_span<T>) {
             static_assert(!std::is_const_v<B> || std::is_const_v<typename T::element_type>,
                           "cannot convert to a std::span over non-const bytes when the source is const");
-            T value{packet.template subspan<0, T::extent>()};
-            packet = packet.template subspan<T::extent>();
+            return T{std::span<B, T::extent>{data, T::extent}};
+        }
+        else if constexpr (concepts::is_swappable_array<T>) {
+            using element_type = array_element_t<T>;
+            constexpr auto length{deserialization_length<T>()};
+            arithmetic_array_view<element_type, array_size<T>(), E, B> view{std::span<B, length>{data, length}};
+
+            if constexpr (concepts::is_std_array<T>) {
+                return view;
+            }
+            else {
+                arithmetic_array<element_type, array_size<T>()> values;
+                bulk_reader::read_n<element_type, array_size<T>(), E> (data, values.values);
+
+                return values;
+            }
+        }
+        else if constexpr (concepts::is_any_array<T>) {
+            static_assert(concepts::is_std_array<T> || std::is_const_v<std::remove_extent_t<T>> || !std::is_const_v<B>,
+                          "cannot convert to a non-const c-style byte array when the source is const");
+            return array_view{std::span<B, array_size<T>()>{data, array_size<T>()}};
+        }
+        else if constexpr (concepts::memcpy_deserializable<T>) {
+            if (!std::is_constant_evaluated()) {
+                return memcpy_deserialize<T, E> (data);
+            }
+
+            return construct_from_tuple_at<T, deserialization_rules::rule_t<T>, E> (data, resource);
+        }
+        else {
+            return construct_from_tuple_at<T, deserialization_rules::rule_t<T>, E> (data, resource);
+        }
+    }
+
+    // The alternatives are dispatched through tables of function pointers indexed by the alternative, one entry per alternative after std::monostate
+    template<typename A, std::endian E, concepts::byte_like B>
+        typename A::value_type deserialize_alternative_at (B * data, size_t alternative, std::pmr::memory_resource * resource)
+    {
+        using V = A::value_type;
+        static constexpr auto table{[] <size_t... Alts> (std::index_sequence<Alts...>) {
+            return std::array<V (*) (B *, std::pmr::memory_resource *), A::size() + 1U>{
+                [] (B *, std::pmr::memory_resource *) { return V{}; },
+                [] (B * data, std::pmr::memory_resource * resource) {
+                    return V{std::in_place_index<Alts + 1U>, deserialize_at<typename A::template alternative_t<Alts + 1U>, E> (data, resource)};
+                }...};
+        } (std::make_index_sequence<A::size()>())};
+
+        return table[alternative] (data, resource);
+    }
+
+    template<typename A, std::endian E, concepts::byte_like B> size_t alternative_length_at (B * data, size_t available, size_t alternative)
+    {
+        static constexpr auto table{[] <size_t... Alts> (std::index_sequence<Alts...>) {
+            return std::array<size_t (*) (B *, size_t), A::size() + 1U>{
+                [] (B *, size_t) { return size_t{0U}; },
+                [] (B * data, size_t available) {
+                    return deserialization_length_at<typename A::template alternative_t<Alts + 1U>, E> (data, available);
+                }...};
+        } (std::make_index_sequence<A::size()>())};
+
+        return table[alternative] (data, available);
+    }
 
-            return value;
+    // The offsets of the elements of a rule, followed by its length, reading the length fields from data;
+    // from the first element that does not fit in "available" bytes, the offsets are std::numeric_limits<size_t>::max()
+    template<typename Tuple, std::endian E, concepts::byte_like B> constexpr auto element_offsets (B * data, size_t available)
+    {
+        constexpr auto npos{std::numeric_limits<size_t>::max()};
+
+        std::array<size_t, std::tuple_size_v<Tuple> + 1U> offsets{};
+        [data, available, &offsets] <size_t... Idx> (std::index_sequence<Idx...>) {
+            ([data, available, &offsets] {
+                using F = std::tuple_element_t<Idx, Tuple>;
+                const auto offset{offsets[Idx]};
+                if (offset == npos) {
+                    offsets[Idx + 1U] = npos;
+                    return;
+                }
+
+                size_t length;
+                if constexpr (is_sized_by<F>::value || is_variant_on<F>::value || is_repeated<F>::value) {
+                    using S = std::tuple_element_t<F::index, Tuple>;
+                    static_assert(F::index < Idx, "sized_by, variant_on, and repeated must refer to a preceding element of the rule");
+                    static_assert(concepts::non_bool_integral<S> || concepts::varint_element<S>,
+                                  "sized_by, variant_on, and repeated must refer to an integral or a varint element of the rule");
+                    const auto key{deserialize_at<S, E> (data + offsets[F::index])};
+                    if constexpr (is_sized_by<F>::value) {
+                        length = static_cast<size_t> (key);
+                    }
+                    else if constexpr (is_repeated<F>::value) {
+                        // Checked before multiplying, so that a large count cannot wrap around
+                        constexpr auto record_length{repeated_helpers::record_length<F>()};
+                        const auto count{static_cast<size_t> (key)};
+                        length = (count <= ((available - offset) / record_length)) ? (count * record_length) : npos;
+                    }
+                    else {
+                        length = alternative_length_at<F, E> (data + offset, available - offset, F::find (static_cast<uint64_t> (key)));
+                    }
+                }
+                else {
+                    length = deserialization_length_at<F, E> (data + offset, available - offset);
+                }
+                offsets[Idx + 1U] = (length <= (available - offset)) ? (offset + length) : npos;
+            } (), ...);
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+
+        return offsets;
+    }
+
+    /// <summary>
+    /// Computes the number of bytes read to deserialize an object of type T from the bytes starting at data, reading its length fields, if any.
+    /// Returns std::numeric_limits<size_t>::max() if the object does not fit in "available" bytes; no byte past them is read.
+    /// </summary>
+    template<typename T, std::endian E, concepts::byte_like B> constexpr size_t deserialization_length_at (B * data, size_t available)
+    {
+        constexpr auto npos{std::numeric_limits<size_t>::max()};
+
+        if constexpr (!has_dynamic_length<T>()) {
+            return (deserialization_length<T>() <= available) ? deserialization_length<T>() : npos;
+        }
+        else if constexpr (concepts::varint_element<T>) {
+            return varint_helpers::length<std::make_unsigned_t<typename T::value_type>> (data, available);
+        }
+        else if constexpr (concepts::dynamic_element<T>) {
+            static_assert(is_length_prefixed<T>::value, "sized_by, variant_on, and repeated can only be deserialized as elements of a deserialization rule");
+            using L = T::length_type;
+            if (available < sizeof(L)) {
+                return npos;
+            }
+
+            const auto length{static_cast<size_t> (reader::read<L, E> (data))};
+            return (length <= (available - sizeof(L))) ? (sizeof(L) + length) : npos;
+        }
+        else {
+            return element_offsets<deserialization_rules::rule_t<T>, E> (data, available).back();
+        }
+    }
+
+    template<typename T, std::endian E, concepts::byte_like B> requires(!concepts::is_any_array<T>) constexpr T deserialize (std::span<B> & packet)
+    {
+        const auto data{packet.data()};
+        if constexpr (concepts::fixed_length<T>) {
+            packet = packet.template subspan<deserialization_length<T>()>();
+
+            return deserialize_at<T, E> (data);
+        }
+        else if constexpr (concepts::varint_element<T>) {
+            packet = packet.subspan (deserialization_length_at<T, E> (data, packet.size()));
+
+            return deserialize_at<T, E> (data);
         }
         else {
-            return construct_from_tuple<T, deserialization_rules::rule_t<T>, E> (packet);
+            // The length fields are read once, both to advance the span and to construct the object
+            using rule = deserialization_rules::rule_t<T>;
+            const auto offsets{element_offsets<rule, E> (data, packet.size())};
+            packet = packet.subspan (offsets.back());
+
+            return construct_from_offsets<T, rule, E> (data, offsets);
         }
     }
 
     template<concepts::is_any_array T, std::endian E, concepts::byte_like B> constexpr auto deserialize (std::span<B> & packet)
     {
-        static_assert(concepts::is_std_array<T> || std::is_const_v<std::remove_extent_t<T>> || !std::is_const_v<B>,
-                      "cannot convert to a non-const c-style byte array when the source is const");
-        array_view view{packet.template subspan<0, array_size<T>()>()};
-        packet = packet.template subspan<array_size<T>()>();
+        const auto data{packet.data()};
+        packet = packet.template subspan<deserialization_length<T>()>();
+
+        return deserialize_at<T, E> (data);
+    }
+
+    /// <summary>
+    /// Deserializes an object of type T from the start of a blob of bytes whose size is known at compile time, e.g. an array filled by #embed.
+    /// The length is checked at compile time, and the whole decode path is usable in constant evaluation, so that tables can be built at compile time:
+    /// constexpr auto table = deserialize&lt;table_type, std::endian::little&gt; (blob);
+    /// </summary>
+    template<typename T, std::endian E, concepts::byte_like B, size_t N> requires(!std::is_array_v<T>) constexpr T deserialize (const B (& blob)[N])
+    {
+        static_assert(concepts::fixed_length<T>, "objects with length_prefixed, sized_by, or variant_on elements cannot be deserialized from a blob");
+        static_assert(N >= deserialization_length<T>(), "the blob is shorter than the deserialization length of T");
+
+        return static_cast<T> (deserialize_at<T, E> (static_cast<const B *> (blob)));
+    }
+
+    template<typename T, std::endian E, concepts::byte_like B, size_t N> requires(!std::is_array_v<T>) constexpr T deserialize (const std::array<B, N> & blob)
+    {
+        static_assert(concepts::fixed_length<T>, "objects with length_prefixed, sized_by, or variant_on elements cannot be deserialized from a blob");
+        static_assert(N >= deserialization_length<T>(), "the blob is shorter than the deserialization length of T");
+
+        return static_cast<T> (deserialize_at<T, E> (blob.data()));
+    }
+
+    template<typename T, std::endian E, concepts::byte_like B, std::output_iterator<T> O> constexpr O deserialize_n (std::span<B> & packet, size_t count, O out)
+    {
+        static_assert(concepts::fixed_length<T>, "back-to-back records must have a length known at compile time");
+        static_assert(deserialization_length<T>() > 0U, "back-to-back records must not be empty");
+        constexpr auto record_length{deserialization_length<T>()};
+        constexpr size_t unroll_factor{4U};
+
+        const auto record_at{[data = packet.data()] (size_t index) {
+            return deserialize_at<T, E> (data + (index * record_length));
+        }};
+        const auto store{[&out, &record_at] (size_t index) {
+            if constexpr (std::contiguous_iterator<O> && std::same_as<std::iter_reference_t<O>, T &> &&
+                          std::is_trivially_destructible_v<T> && concepts::memcpy_deserializable<T>) {
+                // Constructs memcpy-able objects in place in ranges of T, so that they are not copied from a temporary
+                if (!std::is_constant_evaluated()) {
+                    ::new (static_cast<void *> (std::to_address (out))) T(record_at (index));
+                    ++out;
+                    return;
+                }
+            }
+            *out = record_at (index);
+            ++out;
+        }};
+
+        size_t index{0U};
+        for (; (count - index) >= unroll_factor; index += unroll_factor) {
+            [&]<size_t... Is> (std::index_sequence<Is...>)
+            {
+                (store (index + Is), ...);
+            } (std::make_index_sequence<unroll_factor>());
+        }
+        for (; index < count; ++index) {
+            store (index);
+        }
+        packet = packet.subspan (count * record_length);
+
+        return out;
+    }
+
+    template<typename E> struct column_value
+    {
+        using type = E;
+    };
+    template<typename E> requires(std::is_bounded_array_v<E>) struct column_value<E>
+    {
+        using type = std::array<std::remove_cv_t<std::remove_extent_t<E>>, std::extent_v<E>>;
+    };
+    template<typename E> using column_value_t = column_value<E>::type;
+
+    template<typename Tuple> struct columns_from_tuple;
+    template<typename... Es> struct columns_from_tuple<std::tuple<Es...>>
+    {
+        using type = std::tuple<std::span<column_value_t<Es>>...>;
+    };
+
+    /// <summary>
+    /// A std::tuple with one std::span per element of the deserialization rule of T, each receiving the values of that element.
+    /// Built-in byte arrays are stored as std::array.
+    /// </summary>
+    template<typename T> using columns_t = columns_from_tuple<deserialization_rules::rule_t<T>>::type;
+
+    template<typename Tuple, size_t I, std::endian E, concepts::byte_like B, typename C>
+        void deserialize_column (B * data, size_t count, std::span<C> column)
+    {
+        using F = std::tuple_element_t<I, Tuple>;
+        constexpr auto record_length{deserialization_length_from_tuple<Tuple>()};
+        constexpr auto offset{deserialization_offset<Tuple, I>()};
+
+        if (column.empty()) {
+            return;
+        }
+        if constexpr (concepts::non_bool_arithmetic<F>) {
+            bulk_reader::read_strided<F, E> (data + offset, record_length, column.data(), count);
+        }
+        else {
+            for (size_t i{0U}; i < count; ++i) {
+                column[i] = static_cast<C> (deserialize_at<F, E> (data + (i * record_length) + offset));
+            }
+        }
+    }
+
+    template<typename T, std::endian E, concepts::byte_like B> void deserialize_columns (std::span<B> & packet, size_t count, const columns_t<T> & columns)
+    {
+        using rule = deserialization_rules::rule_t<T>;
+        static_assert(concepts::fixed_length<T>, "back-to-back records must have a length known at compile time");
+        static_assert(deserialization_length<T>() > 0U, "back-to-back records must not be empty");
 
-        return view;
+        [&]<size_t... Idx> (std::index_sequence<Idx...>)
+        {
+            (deserialize_column<rule, Idx, E> (packet.data(), count, std::get<Idx> (columns)), ...);
+        } (std::make_index_sequence<std::tuple_size_v<rule>>());
+        packet = packet.subspan (count * deserialization_length<T>());
     }
 
+    /// <summary>
+    /// A view over the bytes of an object of type T, stored with endianness E, whose fields are decoded one at a time, on access.
+    /// Holds a single pointer; fields are read at offsets computed at compile time, and fields that are never accessed are never read.
+    /// The bytes must outlive the view; the view does not check that there are enough of them.
+    /// </summary>
+    template<concepts::ruled T, std::endian E, concepts::byte_like B> class record_view
+    {
+        static_assert(concepts::fixed_length<T>, "record_view requires a type whose length is known at compile time");
+
+    public:
+        using rule = deserialization_rules::rule_t<T>;
+
+        template<size_t I> using field_t = std::tuple_element_t<I, rule>;
+
+        constexpr explicit record_view (B * data) noexcept : data_{data} { }
+
+        /// <summary>
+        /// Decodes the I-th element of the deserialization rule of T.
+        /// Built-in arrays are returned as the views produced by deserialize_at, which convert to a reference to the array.
+        /// </summary>
+        /// <typeparam name="I">The index of the element in the deserialization rule of T</typeparam>
+        /// <returns>The value of the element</returns>
+        template<size_t I> constexpr decltype(auto) get (void) const
+        {
+            if constexpr (std::is_bounded_array_v<field_t<I>>) {
+                return deserialize_at<field_t<I>, E> (field_data<I>());
+            }
+            else {
+                return static_cast<field_t<I>> (deserialize_at<field_t<I>, E> (field_data<I>()));
+            }
+        }
+
+        /// <summary>
+        /// Returns a view over the I-th element of the deserialization rule of T, which is itself deserialized through a rule.
+        /// </summary>
+        /// <typeparam name="I">The index of the element in the deserialization rule of T</typeparam>
+        /// <returns>A record_view over the bytes of the element</returns>
+        template<size_t I> requires(concepts::ruled<field_t<I>>) constexpr record_view<field_t<I>, E, B> view (void) const noexcept
+        { return record_view<field_t<I>, E, B>{field_data<I>()}; }
+
+        /// <summary>
+        /// Decodes the whole object.
+        /// </summary>
+        /// <returns>An instance of an object of type T, constructed from the bytes of the view</returns>
+        constexpr T decode (void) const { return deserialize_at<T, E> (data_); }
+
+        /// <summary>
+        /// Returns a pointer to the first byte of the object.
+        /// </summary>
+        constexpr B * data (void) const noexcept { return data_; }
+
+        /// <summary>
+        /// Returns the number of elements in the deserialization rule of T.
+        /// </summary>
+        static consteval size_t size (void) { return std::tuple_size_v<rule>; }
+
+
+    private:
+        template<size_t I> constexpr B * field_data (void) const noexcept { return data_ + deserialization_offset<rule, I>(); }
+
+        B * data_;
+    };
+
     template<concepts::byte_like B, std::endian E> class object_deserializer
     {
     public:
@@ -109,29 +816,150 @@ namespace little_deserialization_library
 
         /// <summary>
         /// Constructs an object of type T with data in the buffer, possibly using a user-defined deserialization rule.
-        /// Throws a std::length_error if the number of bytes available in the buffer is not enough to deserialize the object.
+        /// Throws a std::length_error if the number of bytes available in the buffer is not enough to deserialize the object;
+        /// if the rule of T contains length_prefixed, sized_by, or repeated elements, their length fields are read and checked too.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <returns>An instance of an object of type T, constructed from data read from the buffer</returns>
+        template<typename T> constexpr T deserialize (void);
+        /// <summary>
+        /// Constructs an object of type T with data in the buffer, as deserialize&lt;T&gt;() does, drawing the std::pmr::vector of every
+        /// repeated element of its rule from "resource", e.g. a std::pmr::monotonic_buffer_resource that is released once per message.
         /// </summary>
         /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <param name="resource">The memory resource of the records of repeated elements</param>
         /// <returns>An instance of an object of type T, constructed from data read from the buffer</returns>
-        template<typename T> T deserialize (void);
+        template<typename T> T deserialize (std::pmr::memory_resource & resource);
         /// <summary>
         /// Constructs an object of type T with data in the buffer, possibly using a user-defined deserialization rule.
         /// Skips length checks. The behavior is undefined if the buffer does not hold enough data to deserialize the object.
+        /// Does not throw, unless the vector of a repeated element fails to allocate.
         /// </summary>
         /// <typeparam name="T">The type of the object to deserialize</typeparam>
         /// <returns>An instance of an object of type T, constructed from data read from the buffer</returns>
-        template<typename T> T deserialize_noexcept (void) noexcept;
+        template<typename T> constexpr T deserialize_noexcept (void) noexcept(concepts::non_allocating<T>);
+        /// <summary>
+        /// Constructs an object of type T with data in the buffer, possibly using a user-defined deserialization rule.
+        /// Does not throw: if the buffer does not hold enough data, returns error::not_enough_bytes and leaves the buffer unchanged.
+        /// Does not allocate either, unless T contains repeated elements; only then it may throw std::bad_alloc.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <returns>An instance of an object of type T, constructed from data read from the buffer, or the error that prevented it</returns>
+        template<typename T> result<T> try_deserialize (void) noexcept(concepts::non_allocating<T>);
+        /// <summary>
+        /// Constructs an object of type T with data in the buffer, as try_deserialize&lt;T&gt;() does, drawing the std::pmr::vector of every
+        /// repeated element of its rule from "resource"; may throw whatever the resource throws when it fails to allocate.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to deserialize</typeparam>
+        /// <param name="resource">The memory resource of the records of repeated elements</param>
+        /// <returns>An instance of an object of type T, constructed from data read from the buffer, or the error that prevented it</returns>
+        template<typename T> result<T> try_deserialize (std::pmr::memory_resource & resource) noexcept(concepts::non_allocating<T>);
+        /// <summary>
+        /// Constructs back-to-back objects of types T, Ts... with data in the buffer, e.g. a stack of protocol headers.
+        /// The buffer length is checked once against the sum of their deserialization lengths, and every field is read at a constant offset.
+        /// Throws a std::length_error if the number of bytes available in the buffer is not enough to deserialize all the objects.
+        /// </summary>
+        /// <typeparam name="T">The type of the first object to deserialize</typeparam>
+        /// <typeparam name="Ts">The types of the objects that follow it</typeparam>
+        /// <returns>A std::tuple with the deserialized objects, in order</returns>
+        template<typename T, typename... Ts> requires(sizeof...(Ts) > 0U) constexpr std::tuple<T, Ts...> deserialize (void);
+        /// <summary>
+        /// Constructs back-to-back objects of types T, Ts... with data in the buffer, e.g. a stack of protocol headers.
+        /// Skips length checks. The behavior is undefined if the buffer does not hold enough data to deserialize all the objects.
+        /// </summary>
+        /// <typeparam name="T">The type of the first object to deserialize</typeparam>
+        /// <typeparam name="Ts">The types of the objects that follow it</typeparam>
+        /// <returns>A std::tuple with the deserialized objects, in order</returns>
+        template<typename T, typename... Ts> requires(sizeof...(Ts) > 0U) constexpr std::tuple<T, Ts...> deserialize_noexcept (void) noexcept;
+        /// <summary>
+        /// Returns a view over the bytes of an object of type T in the buffer, whose fields are decoded only when accessed, and advances the buffer past them.
+        /// Throws a std::length_error if the number of bytes available in the buffer is not enough to deserialize the object.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to view</typeparam>
+        /// <returns>A record_view over the bytes of the object</returns>
+        template<concepts::ruled T> constexpr record_view<T, E, B> view (void);
+        /// <summary>
+        /// Returns a view over the bytes of an object of type T in the buffer, whose fields are decoded only when accessed, and advances the buffer past them.
+        /// Skips length checks. The behavior is undefined if the buffer does not hold enough data to deserialize the object.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to view</typeparam>
+        /// <returns>A record_view over the bytes of the object</returns>
+        template<concepts::ruled T> constexpr record_view<T, E, B> view_noexcept (void) noexcept;
+        /// <summary>
+        /// Constructs an object of the type selected by key among the alternatives Cases, e.g. on<0x0800, ip_header>, with data in the buffer.
+        /// The alternative is looked up in a perfect hash computed at compile time, and decoded through a table of function pointers.
+        /// Returns std::monostate, and leaves the buffer unchanged, if no alternative matches the key.
+        /// Throws a std::length_error if the number of bytes available in the buffer is not enough to deserialize the selected object.
+        /// </summary>
+        /// <typeparam name="Cases">The alternatives, as specializations of on<Key, T></typeparam>
+        /// <param name="key">The key that selects the alternative, e.g. the ethertype of an Ethernet frame</param>
+        /// <returns>A std::variant holding the deserialized object, or std::monostate</returns>
+        template<typename... Cases> requires(sizeof...(Cases) > 0U) variant_of<Cases...> deserialize_on (concepts::non_bool_integral auto key);
+        /// <summary>
+        /// Constructs "count" back-to-back objects of type T with data in the buffer and writes them to the output iterator.
+        /// The buffer length is checked once for the whole run; throws a std::length_error if the buffer does not hold "count" objects.
+        /// </summary>
+        /// <typeparam name="T">The type of the objects to deserialize</typeparam>
+        /// <param name="count">The number of objects to deserialize</param>
+        /// <param name="out">The beginning of the destination range</param>
+        /// <returns>Output iterator to the element past the last element written</returns>
+        template<typename T, std::output_iterator<T> O> requires(!concepts::is_any_array<T>) constexpr O deserialize_n (size_t count, O out);
+        /// <summary>
+        /// Constructs "count" back-to-back objects of type T with data in the buffer and writes them to the output iterator.
+        /// Skips length checks. The behavior is undefined if the buffer does not hold enough data to deserialize "count" objects.
+        /// </summary>
+        /// <typeparam name="T">The type of the objects to deserialize</typeparam>
+        /// <param name="count">The number of objects to deserialize</param>
+        /// <param name="out">The beginning of the destination range</param>
+        /// <returns>Output iterator to the element past the last element written</returns>
+        template<typename T, std::output_iterator<T> O> requires(!concepts::is_any_array<T>) constexpr O deserialize_n_noexcept (size_t count, O out) noexcept;
+        /// <summary>
+        /// Fills "out" with back-to-back objects of type T constructed with data in the buffer.
+        /// Equivalent to deserialize_n<T> (out.size(), out.begin());
+        /// </summary>
+        /// <typeparam name="T">The type of the objects to deserialize</typeparam>
+        /// <param name="out">The destination range; its size is the number of objects to deserialize</param>
+        template<typename T> requires(!concepts::is_any_array<T>) constexpr void deserialize_into (std::span<T> out);
+        /// <summary>
+        /// Fills "out" with values of Bits bits packed back to back, in the bit order of the endianness of the deserializer, as packed_array does,
+        /// and advances past the bytes that hold them. Throws a std::length_error if the buffer holds fewer than out.size() values.
+        /// </summary>
+        /// <typeparam name="Bits">The width of the packed values, from 1 to 32 bits</typeparam>
+        /// <param name="out">The destination range; its size is the number of values to unpack</param>
+        template<size_t Bits, std::unsigned_integral T> constexpr void unpack_into (std::span<T> out);
+        /// <summary>
+        /// Deserializes "count" back-to-back objects of type T column by column: each non-empty std::span in "columns" receives
+        /// the values of the corresponding element of the deserialization rule of T, while empty spans are skipped.
+        /// Arithmetic columns are converted with the bulk byte-swap kernels.
+        /// Throws a std::length_error if the buffer does not hold "count" objects, or if a non-empty column holds less than "count" elements.
+        /// </summary>
+        /// <typeparam name="T">The type whose deserialization rule describes the records</typeparam>
+        /// <param name="count">The number of records to deserialize</param>
+        /// <param name="columns">The destination columns, one per element of the deserialization rule of T</param>
+        template<typename T> void deserialize_columns (size_t count, const columns_t<T> & columns);
         /// <summary>
         /// Advances the buffer by the specified number of bytes.
         /// </summary>
         /// <param name="bytes">The number of bytes to skip in the buffer</param>
-        void skip (size_t bytes);
+        constexpr void skip (size_t bytes);
         /// <summary>
         /// Advances the buffer by the deserialization length of type T.
         /// Equivalent to skip (deserialization_length<T>());
         /// </summary>
         /// <typeparam name="T">The type of object to compute the deserialization length</typeparam>
-        template<typename T> void skip (void);
+        template<typename T> constexpr void skip (void);
+        /// <summary>
+        /// Advances the buffer by the specified number of bytes.
+        /// Does not throw nor allocate: if the buffer holds less bytes, returns error::not_enough_bytes and leaves the buffer unchanged.
+        /// </summary>
+        /// <param name="bytes">The number of bytes to skip in the buffer</param>
+        result<void> try_skip (size_t bytes) noexcept;
+        /// <summary>
+        /// Advances the buffer by the deserialization length of type T.
+        /// Equivalent to try_skip (deserialization_length<T>());
+        /// </summary>
+        /// <typeparam name="T">The type of object to compute the deserialization length</typeparam>
+        template<typename T> result<void> try_skip (void) noexcept;
 
         /// <summary>
         /// Returns a std::span over the first "size" bytes of the unread part of the buffer, or the whole buffer, whichever is smaller.
@@ -143,6 +971,7 @@ namespace little_deserialization_library
 
         /// <summary>
         /// Computes and returns the number of bytes that would be read from the buffer to deserialize an object of type T.
+        /// For types with length_prefixed or sized_by elements, returns the minimum number of bytes, i.e. that of their fixed-size elements.
         /// </summary>
         /// <typeparam name="T">The type of the object</typeparam>
         /// <returns>The number of bytes that will be read to deserialize an object of type T</returns>
@@ -151,28 +980,216 @@ namespace little_deserialization_library
 
 
     private:
+        // The std::pmr::vector of every repeated element is drawn from resource, or from the default memory resource if it is null
+        template<typename T> constexpr T deserialize_with (std::pmr::memory_resource * resource);
+        template<typename T> result<T> try_deserialize_with (std::pmr::memory_resource * resource) noexcept(concepts::non_allocating<T>);
+
         std::span<B> buffer_;
     };
 
     template<concepts::byte_like B> using network_packet_deserializer = object_deserializer<B, std::endian::big>;
 
 
-    template<concepts::byte_like B, std::endian E> template<typename T> inline T object_deserializer<B, E>::deserialize (void)
+    template<concepts::byte_like B, std::endian E> template<typename T> constexpr T object_deserializer<B, E>::deserialize (void)
+    {
+        return deserialize_with<T> (nullptr);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline T object_deserializer<B, E>::deserialize (std::pmr::memory_resource & resource)
+    {
+        return deserialize_with<T> (&resource);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> constexpr T object_deserializer<B, E>::deserialize_with (std::pmr::memory_resource * resource)
     {
-        if (static constexpr auto minimum_buffer_length{object_deserializer::deserialization_length<T>()}; buffer_.size() < minimum_buffer_length) {
+        if (constexpr auto minimum_buffer_length{object_deserializer::deserialization_length<T>()}; buffer_.size() < minimum_buffer_length) {
             throw std::length_error{std::format ("impossible to deserialize the requested object; Required bytes: {}; available bytes: {}",
                                                   minimum_buffer_length, buffer_.size())};
         }
+        if constexpr (concepts::varint_element<T>) {
+            if (deserialization_length_at<T, E> (buffer_.data(), buffer_.size()) > buffer_.size()) {
+                throw std::length_error{std::format ("impossible to deserialize the requested varint; it does not end within the available bytes: {}",
+                                                      buffer_.size())};
+            }
 
-        return deserialize_noexcept<T>();
+            return deserialize_noexcept<T>();
+        }
+        else if constexpr (!concepts::fixed_length<T>) {
+            using rule = deserialization_rules::rule_t<T>;
+            const auto data{buffer_.data()};
+            const auto offsets{element_offsets<rule, E> (data, buffer_.size())};
+            if (offsets.back() > buffer_.size()) {
+                throw std::length_error{std::format ("impossible to deserialize the requested object; its length fields exceed the available bytes: {}",
+                                                      buffer_.size())};
+            }
+            buffer_ = buffer_.subspan (offsets.back());
+
+            return construct_from_offsets<T, rule, E> (data, offsets, resource);
+        }
+        else {
+            return deserialize_noexcept<T>();
+        }
     }
 
-    template<concepts::byte_like B, std::endian E> template<typename T> inline T object_deserializer<B, E>::deserialize_noexcept (void) noexcept
+    template<concepts::byte_like B, std::endian E> template<typename T> constexpr T object_deserializer<B, E>::deserialize_noexcept (void) noexcept(concepts::non_allocating<T>)
     {
         return little_deserialization_library::deserialize<T, E> (buffer_);
     }
 
-    template<concepts::byte_like B, std::endian E> inline void object_deserializer<B, E>::skip (size_t bytes)
+    template<concepts::byte_like B, std::endian E> template<typename T, typename... Ts> requires(sizeof...(Ts) > 0U)
+        constexpr std::tuple<T, Ts...> object_deserializer<B, E>::deserialize (void)
+    {
+        if (constexpr auto minimum_buffer_length{deserialization_length_from_tuple<std::tuple<T, Ts...>>()}; buffer_.size() < minimum_buffer_length) {
+            throw std::length_error{std::format ("impossible to deserialize the requested objects; Required bytes: {}; available bytes: {}",
+                                                  minimum_buffer_length, buffer_.size())};
+        }
+
+        return deserialize_noexcept<T, Ts...>();
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T, typename... Ts> requires(sizeof...(Ts) > 0U)
+        constexpr std::tuple<T, Ts...> object_deserializer<B, E>::deserialize_noexcept (void) noexcept
+    {
+        using objects = std::tuple<T, Ts...>;
+        static_assert((concepts::fixed_length<T> && ... && concepts::fixed_length<Ts>), "all the objects must have a length known at compile time");
+
+        const auto data{buffer_.data()};
+        buffer_ = buffer_.template subspan<deserialization_length_from_tuple<objects>()>();
+
+        return [data] <size_t... Idx> (std::index_sequence<Idx...>) {
+            return objects{static_cast<std::tuple_element_t<Idx, objects>> (
+                little_deserialization_library::deserialize_at<std::tuple_element_t<Idx, objects>, E> (data + deserialization_offset<objects, Idx>()))...};
+        } (std::index_sequence_for<T, Ts...>());
+    }
+
+    template<concepts::byte_like B, std::endian E> template<concepts::ruled T> constexpr record_view<T, E, B> object_deserializer<B, E>::view (void)
+    {
+        if (constexpr auto minimum_buffer_length{object_deserializer::deserialization_length<T>()}; buffer_.size() < minimum_buffer_length) {
+            throw std::length_error{std::format ("impossible to view the requested object; Required bytes: {}; available bytes: {}",
+                                                  minimum_buffer_length, buffer_.size())};
+        }
+
+        return view_noexcept<T>();
+    }
+
+    template<concepts::byte_like B, std::endian E> template<concepts::ruled T> constexpr record_view<T, E, B> object_deserializer<B, E>::view_noexcept (void) noexcept
+    {
+        const auto data{buffer_.data()};
+        buffer_ = buffer_.template subspan<deserialization_length<T>()>();
+
+        return record_view<T, E, B>{data};
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename... Cases> requires(sizeof...(Cases) > 0U)
+        inline variant_of<Cases...> object_deserializer<B, E>::deserialize_on (concepts::non_bool_integral auto key)
+    {
+        using cases = alternatives<Cases...>;
+
+        const auto alternative{cases::find (static_cast<uint64_t> (key))};
+        const auto length{alternative_length_at<cases, E> (buffer_.data(), buffer_.size(), alternative)};
+        if (length > buffer_.size()) {
+            throw std::length_error{std::format ("impossible to deserialize the alternative selected by key {}; available bytes: {}", key, buffer_.size())};
+        }
+
+        const auto data{buffer_.data()};
+        buffer_ = buffer_.subspan (length);
+
+        return deserialize_alternative_at<cases, E> (data, alternative);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline result<T> object_deserializer<B, E>::try_deserialize (void) noexcept(concepts::non_allocating<T>)
+    {
+        return try_deserialize_with<T> (nullptr);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T>
+        inline result<T> object_deserializer<B, E>::try_deserialize (std::pmr::memory_resource & resource) noexcept(concepts::non_allocating<T>)
+    {
+        return try_deserialize_with<T> (&resource);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T>
+        inline result<T> object_deserializer<B, E>::try_deserialize_with (std::pmr::memory_resource * resource) noexcept(concepts::non_allocating<T>)
+    {
+        if (buffer_.size() < object_deserializer::deserialization_length<T>()) {
+            return make_error (error::not_enough_bytes);
+        }
+        if constexpr (concepts::varint_element<T>) {
+            if (deserialization_length_at<T, E> (buffer_.data(), buffer_.size()) > buffer_.size()) {
+                return make_error (error::not_enough_bytes);
+            }
+
+            return deserialize_noexcept<T>();
+        }
+        else if constexpr (!concepts::fixed_length<T>) {
+            using rule = deserialization_rules::rule_t<T>;
+            const auto data{buffer_.data()};
+            const auto offsets{element_offsets<rule, E> (data, buffer_.size())};
+            if (offsets.back() > buffer_.size()) {
+                return make_error (error::not_enough_bytes);
+            }
+            buffer_ = buffer_.subspan (offsets.back());
+
+            const auto make{[data, &offsets, resource] { return construct_from_offsets<T, rule, E> (data, offsets, resource); }};
+            return result<T>{std::in_place, result_helpers::deferred<T, decltype(make)>{make}};
+        }
+        else {
+            const auto make{[this] { return deserialize_noexcept<T>(); }};
+            return result<T>{std::in_place, result_helpers::deferred<T, decltype(make)>{make}};
+        }
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T, std::output_iterator<T> O> requires(!concepts::is_any_array<T>)
+        constexpr O object_deserializer<B, E>::deserialize_n (size_t count, O out)
+    {
+        if (constexpr auto record_length{object_deserializer::deserialization_length<T>()}; (buffer_.size() / record_length) < count) {
+            throw std::length_error{std::format ("impossible to deserialize {} objects of {} bytes each; available bytes: {}",
+                                                  count, record_length, buffer_.size())};
+        }
+
+        return deserialize_n_noexcept<T> (count, out);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T, std::output_iterator<T> O> requires(!concepts::is_any_array<T>)
+        constexpr O object_deserializer<B, E>::deserialize_n_noexcept (size_t count, O out) noexcept
+    {
+        return little_deserialization_library::deserialize_n<T, E> (buffer_, count, out);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> requires(!concepts::is_any_array<T>)
+        constexpr void object_deserializer<B, E>::deserialize_into (std::span<T> out)
+    {
+        deserialize_n<T> (out.size(), out.begin());
+    }
+
+    template<concepts::byte_like B, std::endian E> template<size_t Bits, std::unsigned_integral T>
+        constexpr void object_deserializer<B, E>::unpack_into (std::span<T> out)
+    {
+        if ((out.size() > (std::numeric_limits<size_t>::max() / Bits)) || (bit_unpacker::packed_length<Bits> (out.size()) > buffer_.size())) {
+            throw std::length_error{std::format ("impossible to unpack {} values of {} bits each; available bytes: {}", out.size(), Bits, buffer_.size())};
+        }
+
+        bit_unpacker::unpack<Bits, E> (buffer_.data(), out.data(), out.size());
+        buffer_ = buffer_.subspan (bit_unpacker::packed_length<Bits> (out.size()));
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T>
+        inline void object_deserializer<B, E>::deserialize_columns (size_t count, const columns_t<T> & columns)
+    {
+        if (static constexpr auto record_length{object_deserializer::deserialization_length<T>()}; (buffer_.size() / record_length) < count) {
+            throw std::length_error{std::format ("impossible to deserialize {} objects of {} bytes each; available bytes: {}",
+                                                  count, record_length, buffer_.size())};
+        }
+        std::apply ([count] (const auto &... column) {
+            if (((!column.empty() && (column.size() < count)) || ...)) {
+                throw std::length_error{std::format ("impossible to store {} values in a column", count)};
+            }
+        }, columns);
+
+        little_deserialization_library::deserialize_columns<T, E> (buffer_, count, columns);
+    }
+
+    template<concepts::byte_like B, std::endian E> constexpr void object_deserializer<B, E>::skip (size_t bytes)
     {
         if (buffer_.size() < bytes) {
             throw std::length_error{std::format ("impossible to skip {} bytes: available bytes {}", bytes, buffer_.size())};
@@ -181,8 +1198,9 @@ namespace little_deserialization_library
         buffer_ = buffer_.subspan (bytes);
     }
 
-    template<concepts::byte_like B, std::endian E> template<typename T> inline void object_deserializer<B, E>::skip (void)
+    template<concepts::byte_like B, std::endian E> template<typename T> constexpr void object_deserializer<B, E>::skip (void)
     {
+        static_assert(concepts::fixed_length<T>, "cannot skip an object whose length is read from the buffer");
         constexpr auto bytes{deserialization_length<T>()};
         if (buffer_.size() < bytes) {
             throw std::length_error{std::format ("impossible to skip {} bytes: available bytes {}", bytes, buffer_.size())};
@@ -190,4 +1208,21 @@ namespace little_deserialization_library
 
         buffer_ = buffer_.template subspan<bytes>();
     }
+
+    template<concepts::byte_like B, std::endian E> inline result<void> object_deserializer<B, E>::try_skip (size_t bytes) noexcept
+    {
+        if (buffer_.size() < bytes) {
+            return make_error (error::not_enough_bytes);
+        }
+
+        buffer_ = buffer_.subspan (bytes);
+
+        return {};
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline result<void> object_deserializer<B, E>::try_skip (void) noexcept
+    {
+        static_assert(concepts::fixed_length<T>, "cannot skip an object whose length is read from the buffer");
+        return try_skip (deserialization_length<T>());
+    }
 }
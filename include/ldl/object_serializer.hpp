@@ -0,0 +1,376 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+#include "helpers/ldl_writer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace serialization_rules
+    {
+        /// <summary>
+        /// Returns the values written by the deserialization rule of T, in the order of the constructor arguments that the rule produces.
+        /// By default, the members of T are taken in order, through a structured binding: this fits aggregates whose members match the rule.
+        /// Specialize it for types that are constructed from the rule in a different way, e.g. through a constructor.
+        /// </summary>
+        template<typename T> struct fields;
+    }
+
+    namespace serialization_helpers
+    {
+        // Binds the N members of an aggregate, in order
+        template<size_t N, typename T> constexpr auto members (const T & value)
+        {
+            static_assert(std::is_aggregate_v<T>, "the members of T cannot be bound: specialize serialization_rules::fields<T>");
+
+            if constexpr (N == 1U) {
+                const auto & [m0] = value;
+                return std::tie (m0);
+            }
+            else if constexpr (N == 2U) {
+                const auto & [m0, m1] = value;
+                return std::tie (m0, m1);
+            }
+            else if constexpr (N == 3U) {
+                const auto & [m0, m1, m2] = value;
+                return std::tie (m0, m1, m2);
+            }
+            else if constexpr (N == 4U) {
+                const auto & [m0, m1, m2, m3] = value;
+                return std::tie (m0, m1, m2, m3);
+            }
+            else if constexpr (N == 5U) {
+                const auto & [m0, m1, m2, m3, m4] = value;
+                return std::tie (m0, m1, m2, m3, m4);
+            }
+            else if constexpr (N == 6U) {
+                const auto & [m0, m1, m2, m3, m4, m5] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5);
+            }
+            else if constexpr (N == 7U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6);
+            }
+            else if constexpr (N == 8U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7);
+            }
+            else if constexpr (N == 9U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8);
+            }
+            else if constexpr (N == 10U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+            }
+            else if constexpr (N == 11U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+            }
+            else if constexpr (N == 12U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+            }
+            else if constexpr (N == 13U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+            }
+            else if constexpr (N == 14U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+            }
+            else if constexpr (N == 15U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+            }
+            else if constexpr (N == 16U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+            }
+            else if constexpr (N == 17U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16);
+            }
+            else if constexpr (N == 18U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17);
+            }
+            else if constexpr (N == 19U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18);
+            }
+            else if constexpr (N == 20U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19);
+            }
+            else if constexpr (N == 21U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20);
+            }
+            else if constexpr (N == 22U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21);
+            }
+            else if constexpr (N == 23U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22);
+            }
+            else if constexpr (N == 24U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23);
+            }
+            else if constexpr (N == 25U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24);
+            }
+            else if constexpr (N == 26U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25);
+            }
+            else if constexpr (N == 27U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26);
+            }
+            else if constexpr (N == 28U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27);
+            }
+            else if constexpr (N == 29U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28);
+            }
+            else if constexpr (N == 30U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29);
+            }
+            else if constexpr (N == 31U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30);
+            }
+            else if constexpr (N == 32U) {
+                const auto & [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31] = value;
+                return std::tie (m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15, m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
+            }
+            else {
+                static_assert(N <= 32U, "aggregates with more than 32 members need a specialization of serialization_rules::fields<T>");
+            }
+        }
+
+        template<typename T> constexpr auto fields_of (const T & value)
+        {
+            if constexpr (requires { serialization_rules::fields<T>::get (value); }) {
+                return serialization_rules::fields<T>::get (value);
+            }
+            else {
+                return members<rule_arguments<deserialization_rules::rule_t<T>>().size()> (value);
+            }
+        }
+
+        // The index of the first constructor argument produced by the I-th element of a rule
+        template<typename Tuple, size_t I> consteval size_t first_argument (void)
+        {
+            return [] <size_t... Idx> (std::index_sequence<Idx...>) {
+                return (size_t{0U} + ... + argument_count<std::tuple_element_t<Idx, Tuple>>());
+            } (std::make_index_sequence<I>());
+        }
+    }
+
+    template<typename T, std::endian E, concepts::byte_like B> void serialize_at (const T & value, B * data);
+
+    // Writes a field of type F from "value", the member of an object that the field initializes when deserialized
+    template<typename F, std::endian E, concepts::byte_like B, typename V> void serialize_field_at (const V & value, B * data)
+    {
+        if constexpr (concepts::non_bool_arithmetic<F>) {
+            writer::write<F, E> (data, static_cast<F> (value));
+        }
+        else if constexpr (concepts::is_swappable_array<F>) {
+            using element_type = array_element_t<F>;
+            const auto src{reinterpret_cast<const unsigned char *> (std::data (value))};
+            if constexpr (std::endian::native != E) {
+                bulk_reader_helpers::swap_copy<sizeof(element_type)> (src, reinterpret_cast<unsigned char *> (data), array_size<F>());
+            }
+            else {
+                std::memcpy (data, src, deserialization_length<F>());
+            }
+        }
+        else if constexpr (is_packed_array<F>::value) {
+            bit_unpacker::pack<F::bits, E> (std::data (value), data, std::tuple_size_v<typename F::array_type>);
+        }
+        else if constexpr (concepts::is_any_array<F> || concepts::is_static_extent_byte_span<F>) {
+            // A span over the bytes it is written to needs no copy, e.g. when an object is written back where it was read from
+            if (static_cast<const void *> (std::data (value)) != static_cast<const void *> (data)) {
+                std::memmove (data, std::data (value), deserialization_length<F>());
+            }
+        }
+        else {
+            serialize_at<F, E> (static_cast<const F &> (value), data);
+        }
+    }
+
+    // Every field is written at its own offset from data; the bytes of skipped elements are left as they are
+    template<typename T, typename Tuple, std::endian E, concepts::byte_like B> void serialize_from_tuple_at (const T & value, B * data)
+    {
+        const auto fields{serialization_helpers::fields_of (value)};
+        static_assert(std::tuple_size_v<std::remove_cvref_t<decltype(fields)>> == rule_arguments<Tuple>().size(),
+                      "the fields of T do not match the arguments produced by its deserialization rule");
+
+        [&fields, data] <size_t... Idx> (std::index_sequence<Idx...>) {
+            ([&fields, data] {
+                using F = std::tuple_element_t<Idx, Tuple>;
+                constexpr auto first{serialization_helpers::first_argument<Tuple, Idx>()};
+                const auto field{data + deserialization_offset<Tuple, Idx>()};
+
+                if constexpr (concepts::bit_fields<F>) {
+                    F word{};
+                    [&fields, &word] <size_t... Parts> (std::index_sequence<Parts...>) {
+                        (word.template set<Parts> (static_cast<typename F::template field_type<Parts>> (std::get<first + Parts> (fields))), ...);
+                    } (std::make_index_sequence<F::size()>());
+                    writer::write<decltype(F::word), E> (field, word.word);
+                }
+                else if constexpr (!concepts::skipped_element<F>) {
+                    serialize_field_at<F, E> (std::get<first> (fields), field);
+                }
+            } (), ...);
+        } (std::make_index_sequence<std::tuple_size_v<Tuple>>());
+    }
+
+    /// <summary>
+    /// Serializes an object of type T to the bytes starting at data, without bounds checks, as deserialize_at&lt;T, E&gt; would read it back.
+    /// The fields of user-defined types are written at the offsets computed at compile time for deserialization.
+    /// </summary>
+    template<typename T, std::endian E, concepts::byte_like B> void serialize_at (const T & value, B * data)
+    {
+        static_assert(!std::is_const_v<B>, "cannot serialize to const bytes");
+        static_assert(concepts::fixed_length<T>, "objects with length_prefixed, sized_by, or variant_on elements cannot be serialized");
+
+        if constexpr (concepts::non_bool_arithmetic<T> || concepts::is_any_array<T> || concepts::is_static_extent_byte_span<T>) {
+            serialize_field_at<T, E> (value, data);
+        }
+        else if constexpr (concepts::memcpy_deserializable<T>) {
+            std::memcpy (data, &value, sizeof(T));
+            if constexpr (std::endian::native != E) {
+                bulk_reader_helpers::swap_units<sizeof(T), swap_units<deserialization_rules::rule_t<T>>()> (reinterpret_cast<unsigned char *> (data));
+            }
+        }
+        else {
+            serialize_from_tuple_at<T, deserialization_rules::rule_t<T>, E> (value, data);
+        }
+    }
+
+    template<concepts::byte_like B, std::endian E> class object_serializer
+    {
+        static_assert(!std::is_const_v<B>, "cannot serialize to const bytes");
+
+    public:
+        template<size_t N> constexpr explicit object_serializer (std::span<B, N> buffer) noexcept : buffer_{buffer} { }
+
+        /// <summary>
+        /// Writes an object of type T to the buffer, in the layout described by its deserialization rule, and advances past it.
+        /// Throws a std::length_error if the buffer is shorter than the deserialization length of T.
+        /// The bytes of skip and ignore elements are left as they are, so that an object read through a projection rule can be written back in place.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to serialize</typeparam>
+        /// <param name="value">The object to serialize</param>
+        template<typename T> void serialize (const T & value);
+        /// <summary>
+        /// Writes an object of type T to the buffer, in the layout described by its deserialization rule, and advances past it.
+        /// Skips length checks. The behavior is undefined if the buffer is shorter than the deserialization length of T.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to serialize</typeparam>
+        /// <param name="value">The object to serialize</param>
+        template<typename T> void serialize_noexcept (const T & value) noexcept;
+        /// <summary>
+        /// Writes an object of type T to the buffer, in the layout described by its deserialization rule, and advances past it.
+        /// Does not throw: if the buffer is too short, returns error::not_enough_bytes and leaves the buffer unchanged.
+        /// </summary>
+        /// <typeparam name="T">The type of the object to serialize</typeparam>
+        /// <param name="value">The object to serialize</param>
+        template<typename T> result<void> try_serialize (const T & value) noexcept;
+        /// <summary>
+        /// Advances the position in the buffer by the specified number of bytes, leaving them as they are.
+        /// </summary>
+        /// <param name="bytes">The number of bytes to skip</param>
+        void skip (size_t bytes);
+        /// <summary>
+        /// Advances the position in the buffer by the deserialization length of type T, leaving the bytes as they are.
+        /// </summary>
+        /// <typeparam name="T">The type of object to compute the deserialization length</typeparam>
+        template<typename T> void skip (void);
+
+        /// <summary>
+        /// Returns a std::span over the first "size" bytes of the unwritten part of the buffer, or the whole buffer, whichever is smaller.
+        /// </summary>
+        /// <param name="size">The maximum number of bytes to include in the returned buffer</param>
+        /// <returns>A std::span over at most the first "size" unwritten bytes in the buffer</returns>
+        constexpr std::span<B> get_unwritten_buffer (size_t size = std::numeric_limits<size_t>::max()) const
+        { return buffer_.first (std::min (buffer_.size(), size)); }
+
+        /// <summary>
+        /// Computes and returns the number of bytes that are written to the buffer to serialize an object of type T.
+        /// </summary>
+        /// <typeparam name="T">The type of the object</typeparam>
+        /// <returns>The number of bytes that will be written to serialize an object of type T</returns>
+        template<typename T> static consteval auto serialization_length (void)
+        { return little_deserialization_library::deserialization_length<T>(); }
+
+
+    private:
+        std::span<B> buffer_;
+    };
+
+    template<concepts::byte_like B> using network_packet_serializer = object_serializer<B, std::endian::big>;
+
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline void object_serializer<B, E>::serialize (const T & value)
+    {
+        if (static constexpr auto minimum_buffer_length{object_serializer::serialization_length<T>()}; buffer_.size() < minimum_buffer_length) {
+            throw std::length_error{std::format ("impossible to serialize the requested object; Required bytes: {}; available bytes: {}",
+                                                  minimum_buffer_length, buffer_.size())};
+        }
+
+        serialize_noexcept (value);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline void object_serializer<B, E>::serialize_noexcept (const T & value) noexcept
+    {
+        serialize_at<T, E> (value, buffer_.data());
+        buffer_ = buffer_.subspan (serialization_length<T>());
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline result<void> object_serializer<B, E>::try_serialize (const T & value) noexcept
+    {
+        if (buffer_.size() < serialization_length<T>()) {
+            return make_error (error::not_enough_bytes);
+        }
+
+        serialize_noexcept (value);
+
+        return {};
+    }
+
+    template<concepts::byte_like B, std::endian E> inline void object_serializer<B, E>::skip (size_t bytes)
+    {
+        if (buffer_.size() < bytes) {
+            throw std::length_error{std::format ("impossible to skip {} bytes: available bytes {}", bytes, buffer_.size())};
+        }
+
+        buffer_ = buffer_.subspan (bytes);
+    }
+
+    template<concepts::byte_like B, std::endian E> template<typename T> inline void object_serializer<B, E>::skip (void)
+    {
+        skip (serialization_length<T>());
+    }
+}
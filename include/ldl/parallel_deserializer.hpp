@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <exception>
+#include <format>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace parallel_helpers
+    {
+        // Bytes of input decoded by a task, so that its input and output stay in the private caches of the core that runs it
+        inline constexpr size_t chunk_bytes{32U * 1024U};
+
+        inline size_t default_thread_count (void) noexcept { return std::max (std::thread::hardware_concurrency(), 1U); }
+
+        // Runs task(i) for every i in [0, tasks) on up to thread_count threads, the calling one included. Threads claim the next task
+        // from a shared counter as soon as they are done with the previous one, so that faster threads take over the work left by slower ones.
+        // The first exception thrown by a task stops the handing out of tasks, and is rethrown on the calling thread once all threads are joined
+        template<typename F> void run (size_t tasks, size_t thread_count, const F & task)
+        {
+            if (tasks == 0U) {
+                return;
+            }
+
+            std::atomic<size_t> next{0U};
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            const auto work{[&next, &error, &error_mutex, tasks, &task] {
+                try {
+                    for (auto i{next.fetch_add (1U, std::memory_order_relaxed)}; i < tasks; i = next.fetch_add (1U, std::memory_order_relaxed)) {
+                        task (i);
+                    }
+                }
+                catch (...) {
+                    next.store (tasks, std::memory_order_relaxed);
+                    const std::lock_guard lock{error_mutex};
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }};
+
+            const auto workers{std::clamp<size_t> (thread_count, 1U, tasks)};
+            {
+                std::vector<std::jthread> threads;
+                threads.reserve (workers - 1U);
+                for (size_t i{1U}; i < workers; ++i) {
+                    threads.emplace_back (work);
+                }
+                work();
+            }
+
+            if (error) {
+                std::rethrow_exception (error);
+            }
+        }
+
+        // The number of records decoded by a task; for types of variable length, their minimum length is taken
+        template<typename T> consteval size_t records_per_chunk (void)
+        {
+            return std::max<size_t> (chunk_bytes / std::max<size_t> (deserialization_length<T>(), 1U), 1U);
+        }
+    }
+
+    namespace concepts
+    {
+        /// <summary>
+        /// Requires that F returns the length of the record at the front of a std::span&lt;B&gt;, as the framing pass of parallel_deserialize does.
+        /// </summary>
+        template<typename F, typename B> concept framing = std::regular_invocable<const F &, std::span<B>> &&
+                                                           std::convertible_to<std::invoke_result_t<const F &, std::span<B>>, size_t>;
+    }
+
+    /// <summary>
+    /// Deserializes out.size() back-to-back records of type T, whose length is known at compile time, on up to thread_count threads.
+    /// The buffer is split into chunks of a few tens of kilobytes, decoded independently; no pre-scan is needed.
+    /// Throws a std::length_error if the buffer does not hold out.size() records.
+    /// </summary>
+    /// <typeparam name="T">The type of the records</typeparam>
+    /// <typeparam name="E">The endianness of the records</typeparam>
+    /// <param name="buffer">The buffer that holds the records</param>
+    /// <param name="out">The records, in the order in which they are in the buffer</param>
+    /// <param name="thread_count">The maximum number of threads, the calling one included</param>
+    /// <returns>The number of records deserialized, i.e. out.size()</returns>
+    template<concepts::fixed_length T, std::endian E, concepts::byte_like B, size_t N>
+    size_t parallel_deserialize (std::span<B, N> buffer, std::span<T> out, size_t thread_count = parallel_helpers::default_thread_count())
+    {
+        static constexpr auto record_length{deserialization_length<T>()};
+        static constexpr auto chunk_records{parallel_helpers::records_per_chunk<T>()};
+
+        // Divided rather than multiplied, so that a large out.size() cannot wrap around
+        if ((buffer.size() / record_length) < out.size()) {
+            throw std::length_error{std::format ("impossible to deserialize {} objects of {} bytes each; available bytes: {}",
+                                                  out.size(), record_length, buffer.size())};
+        }
+
+        const auto chunks{(out.size() + chunk_records - 1U) / chunk_records};
+        parallel_helpers::run (chunks, thread_count, [buffer, out] (size_t chunk) {
+            const auto first{chunk * chunk_records};
+            const auto count{std::min (chunk_records, out.size() - first)};
+            std::span<B> records{buffer.subspan (first * record_length, count * record_length)};
+            (void) deserialize_n<T, E> (records, count, out.begin() + static_cast<std::ptrdiff_t> (first));
+        });
+
+        return out.size();
+    }
+
+    /// <summary>
+    /// Deserializes up to out.size() back-to-back records of type T, whose lengths are found by "frame", on up to thread_count threads.
+    /// A sequential framing pass calls frame(unread) for the unread part of the buffer, and stops at the first record whose length is 0,
+    /// greater than the unread bytes, or shorter than the record that starts there; the records found are then deserialized in parallel,
+    /// each from the bytes of its own frame.
+    /// </summary>
+    /// <typeparam name="T">The type of the records</typeparam>
+    /// <typeparam name="E">The endianness of the records</typeparam>
+    /// <param name="buffer">The buffer that holds the records</param>
+    /// <param name="out">The records, in the order in which they are in the buffer</param>
+    /// <param name="frame">A callable that returns the length of the record at the front of a std::span&lt;B&gt;</param>
+    /// <param name="thread_count">The maximum number of threads, the calling one included</param>
+    /// <returns>The number of records deserialized, at the front of out</returns>
+    template<typename T, std::endian E, concepts::byte_like B, size_t N, concepts::framing<B> F>
+    size_t parallel_deserialize (std::span<B, N> buffer, std::span<T> out, const F & frame, size_t thread_count = parallel_helpers::default_thread_count())
+    {
+        static constexpr auto chunk_records{parallel_helpers::records_per_chunk<T>()};
+
+        // The start of every record, followed by the end of the last one
+        std::vector<size_t> offsets{0U};
+        offsets.reserve (out.size() + 1U);
+        for (std::span<B> unread{buffer}; offsets.size() <= out.size();) {
+            const auto length{static_cast<size_t> (frame (unread))};
+            // A frame shorter than its record would be read past by deserialize
+            if ((length == 0U) || (length > unread.size()) || (deserialization_length_at<T, E> (unread.data(), length) > length)) {
+                break;
+            }
+            unread = unread.subspan (length);
+            offsets.push_back (offsets.back() + length);
+        }
+
+        const auto records{offsets.size() - 1U};
+        const auto chunks{(records + chunk_records - 1U) / chunk_records};
+        parallel_helpers::run (chunks, thread_count, [buffer, out, &offsets, records] (size_t chunk) {
+            const auto last{std::min (records, (chunk + 1U) * chunk_records)};
+            for (auto i{chunk * chunk_records}; i < last; ++i) {
+                std::span<B> record{buffer.subspan (offsets[i], offsets[i + 1U] - offsets[i])};
+                out[i] = deserialize<T, E> (record);
+            }
+        });
+
+        return records;
+    }
+
+    /// <summary>
+    /// Deserializes up to out.size() back-to-back records of type T, whose rule contains length_prefixed or sized_by elements,
+    /// on up to thread_count threads. The framing pass reads the length fields of every record, and stops at the first one that is truncated.
+    /// </summary>
+    /// <typeparam name="T">The type of the records</typeparam>
+    /// <typeparam name="E">The endianness of the records</typeparam>
+    /// <param name="buffer">The buffer that holds the records</param>
+    /// <param name="out">The records, in the order in which they are in the buffer</param>
+    /// <param name="thread_count">The maximum number of threads, the calling one included</param>
+    /// <returns>The number of records deserialized, at the front of out</returns>
+    template<typename T, std::endian E, concepts::byte_like B, size_t N> requires(!concepts::fixed_length<T>)
+    size_t parallel_deserialize (std::span<B, N> buffer, std::span<T> out, size_t thread_count = parallel_helpers::default_thread_count())
+    {
+        const auto frame{[] (std::span<B> unread) {
+            const auto length{deserialization_length_at<T, E> (unread.data(), unread.size())};
+            return (length == std::numeric_limits<size_t>::max()) ? size_t{0U} : length;
+        }};
+
+        return parallel_deserialize<T, E> (buffer, out, frame, thread_count);
+    }
+}
@@ -0,0 +1,351 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+#include "runtime_endian_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace pcap
+    {
+        /// <summary>
+        /// The global header of a pcap file.
+        /// </summary>
+        struct file_header
+        {
+            uint32_t magic_number;
+            uint16_t version_major;
+            uint16_t version_minor;
+            int32_t  thiszone;
+            uint32_t sigfigs;
+            uint32_t snaplen;
+            uint32_t network;           // Link-layer header type, e.g. 1 for Ethernet
+        };
+
+        /// <summary>
+        /// The header of a record in a pcap file.
+        /// </summary>
+        struct record_header
+        {
+            uint32_t ts_sec;
+            uint32_t ts_fraction;       // Microseconds or nanoseconds, depending on the magic number of the file
+            uint32_t captured_length;
+            uint32_t original_length;
+        };
+
+        /// <summary>
+        /// A record of a pcap file: its header, and a view of the captured bytes in the file.
+        /// </summary>
+        struct record
+        {
+            record_header header;
+            std::span<const uint8_t> data;
+        };
+
+        /// <summary>
+        /// The type and the length of a block of a pcapng file.
+        /// </summary>
+        struct block_header
+        {
+            uint32_t type;
+            uint32_t total_length;
+        };
+
+        /// <summary>
+        /// The fixed-size fields of an Enhanced Packet Block of a pcapng file.
+        /// </summary>
+        struct enhanced_packet_header
+        {
+            uint32_t interface_id;
+            uint32_t timestamp_high;
+            uint32_t timestamp_low;
+            uint32_t captured_length;
+            uint32_t original_length;
+        };
+
+        /// <summary>
+        /// A packet of a pcapng file, from an Enhanced or a Simple Packet Block, and a view of the captured bytes in the file.
+        /// The timestamp is in units of the if_tsresol option of the interface, microseconds by default; it is 0 for Simple Packet Blocks.
+        /// </summary>
+        struct packet
+        {
+            uint32_t interface_id;
+            uint64_t timestamp;
+            uint32_t original_length;
+            std::span<const uint8_t> data;
+        };
+    }
+
+    namespace deserialization_rules
+    {
+        template<> struct rule<pcap::file_header>
+        {
+            using type = std::tuple<uint32_t, uint16_t, uint16_t, int32_t, uint32_t, uint32_t, uint32_t>;
+        };
+
+        template<> struct rule<pcap::record_header>
+        {
+            using type = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>;
+        };
+
+        template<> struct rule<pcap::block_header>
+        {
+            using type = std::tuple<uint32_t, uint32_t>;
+        };
+
+        template<> struct rule<pcap::enhanced_packet_header>
+        {
+            using type = std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t>;
+        };
+    }
+
+    namespace pcap_helpers
+    {
+        inline constexpr uint32_t microsecond_magic{0xA1B2C3D4U};
+        inline constexpr uint32_t nanosecond_magic{0xA1B23C4DU};
+
+        inline constexpr uint32_t section_header_block{0x0A0D0D0AU};
+        inline constexpr uint32_t simple_packet_block{0x00000003U};
+        inline constexpr uint32_t enhanced_packet_block{0x00000006U};
+        inline constexpr uint32_t byte_order_magic{0x1A2B3C4DU};
+
+        // Deserializes an object of type T from the front of "bytes", in the endianness of the file, and moves past it
+        template<typename T> T deserialize (std::span<const uint8_t> & bytes, std::endian endianness) noexcept
+        {
+            runtime_endian_deserializer deserializer{bytes, endianness};
+            const auto object{deserializer.deserialize_noexcept<T>()};
+            bytes = deserializer.get_unread_buffer();
+            return object;
+        }
+
+        // Returns the record at the front of "bytes" and moves past it, or nothing if the record is truncated
+        inline std::optional<pcap::record> next_record (std::span<const uint8_t> & bytes, std::endian endianness) noexcept
+        {
+            if (bytes.size() < deserialization_length<pcap::record_header>()) {
+                return std::nullopt;
+            }
+            auto unread{bytes};
+            const auto header{deserialize<pcap::record_header> (unread, endianness)};
+            if (unread.size() < header.captured_length) {
+                return std::nullopt;
+            }
+            bytes = unread.subspan (header.captured_length);
+
+            return pcap::record{header, unread.first (header.captured_length)};
+        }
+
+        // Returns the next packet in "bytes" and moves past its block, or nothing if there are no more packets or a block is malformed;
+        // Section Header Blocks update the endianness, and blocks of other types are skipped
+        inline std::optional<pcap::packet> next_packet (std::span<const uint8_t> & bytes, std::endian & endianness) noexcept
+        {
+            constexpr auto block_header_length{deserialization_length<pcap::block_header>()};
+            // The fixed-size fields of a block are followed by a copy of its total length
+            constexpr auto trailer_length{sizeof(uint32_t)};
+
+            while (bytes.size() >= (block_header_length + trailer_length)) {
+                auto body{bytes};
+                if (deserialize<uint32_t> (body, endianness) == section_header_block) {
+                    // The type is a palindrome, so the byte-order magic that follows the length tells the endianness of the section
+                    auto magic{body.subspan (sizeof(uint32_t))};
+                    endianness = (deserialize<uint32_t> (magic, std::endian::big) == byte_order_magic) ? std::endian::big : std::endian::little;
+                }
+
+                body = bytes;
+                const auto block{deserialize<pcap::block_header> (body, endianness)};
+                if ((block.total_length < (block_header_length + trailer_length)) || ((block.total_length % 4U) != 0U) || (block.total_length > bytes.size())) {
+                    return std::nullopt;
+                }
+                body = body.first (block.total_length - block_header_length - trailer_length);
+                bytes = bytes.subspan (block.total_length);
+
+                if ((block.type == enhanced_packet_block) && (body.size() >= deserialization_length<pcap::enhanced_packet_header>())) {
+                    const auto header{deserialize<pcap::enhanced_packet_header> (body, endianness)};
+                    if (body.size() < header.captured_length) {
+                        return std::nullopt;
+                    }
+                    return pcap::packet{header.interface_id, (uint64_t{header.timestamp_high} << 32U) | header.timestamp_low, header.original_length,
+                                        body.first (header.captured_length)};
+                }
+                if ((block.type == simple_packet_block) && (body.size() >= sizeof(uint32_t))) {
+                    const auto original_length{deserialize<uint32_t> (body, endianness)};
+                    return pcap::packet{0U, 0U, original_length, body.first (std::min<size_t> (original_length, body.size()))};
+                }
+            }
+
+            return std::nullopt;
+        }
+    }
+
+    namespace pcap
+    {
+        /// <summary>
+        /// Iterates over the records of a pcap file held in memory, e.g. by a mapped_file_source, without copying their bytes.
+        /// The endianness of the file is detected from its magic number. Iteration stops at the first truncated record,
+        /// as found at the end of captures that were interrupted.
+        /// </summary>
+        class reader
+        {
+        public:
+            class iterator
+            {
+            public:
+                using value_type = record;
+                using difference_type = std::ptrdiff_t;
+
+                iterator (void) = default;
+                iterator (std::span<const uint8_t> records, std::endian endianness) noexcept
+                    : unread_{records}, endianness_{endianness}, record_{pcap_helpers::next_record (unread_, endianness_)}
+                { }
+
+                const record & operator* (void) const noexcept { return *record_; }
+                const record * operator-> (void) const noexcept { return &*record_; }
+                iterator & operator++ (void) noexcept
+                {
+                    record_ = pcap_helpers::next_record (unread_, endianness_);
+                    return *this;
+                }
+                iterator operator++ (int) noexcept
+                {
+                    auto previous{*this};
+                    ++*this;
+                    return previous;
+                }
+                friend bool operator== (const iterator & it, std::default_sentinel_t) noexcept { return !it.record_.has_value(); }
+
+            private:
+                std::span<const uint8_t> unread_;
+                std::endian endianness_{std::endian::native};
+                std::optional<record> record_;
+            };
+
+            /// <summary>
+            /// Reads the global header of the pcap file in "file".
+            /// Throws a std::length_error if "file" is shorter than the global header, and a std::invalid_argument if its magic number is unknown.
+            /// </summary>
+            /// <param name="file">The contents of the file</param>
+            explicit reader (std::span<const uint8_t> file);
+
+            /// <summary>
+            /// Returns the global header of the file, with its fields converted to the native endianness.
+            /// </summary>
+            const file_header & header (void) const noexcept { return header_; }
+            /// <summary>
+            /// Returns the endianness in which the file was written.
+            /// </summary>
+            std::endian endianness (void) const noexcept { return endianness_; }
+            /// <summary>
+            /// Whether the fractional part of the timestamps is in nanoseconds, rather than microseconds.
+            /// </summary>
+            bool nanosecond_resolution (void) const noexcept { return header_.magic_number == pcap_helpers::nanosecond_magic; }
+
+            iterator begin (void) const noexcept { return {records_, endianness_}; }
+            std::default_sentinel_t end (void) const noexcept { return std::default_sentinel; }
+
+        private:
+            std::span<const uint8_t> records_;
+            std::endian endianness_{std::endian::little};
+            file_header header_{};
+        };
+
+        /// <summary>
+        /// Iterates over the packets of a pcapng file held in memory, e.g. by a mapped_file_source, without copying their bytes.
+        /// Packets are read from Enhanced and Simple Packet Blocks, and other blocks are skipped. The endianness of every section is detected
+        /// from its Section Header Block. Iteration stops at the first truncated or malformed block.
+        /// </summary>
+        class ng_reader
+        {
+        public:
+            class iterator
+            {
+            public:
+                using value_type = packet;
+                using difference_type = std::ptrdiff_t;
+
+                iterator (void) = default;
+                explicit iterator (std::span<const uint8_t> blocks) noexcept
+                    : unread_{blocks}, packet_{pcap_helpers::next_packet (unread_, endianness_)}
+                { }
+
+                const packet & operator* (void) const noexcept { return *packet_; }
+                const packet * operator-> (void) const noexcept { return &*packet_; }
+                iterator & operator++ (void) noexcept
+                {
+                    packet_ = pcap_helpers::next_packet (unread_, endianness_);
+                    return *this;
+                }
+                iterator operator++ (int) noexcept
+                {
+                    auto previous{*this};
+                    ++*this;
+                    return previous;
+                }
+                friend bool operator== (const iterator & it, std::default_sentinel_t) noexcept { return !it.packet_.has_value(); }
+
+            private:
+                std::span<const uint8_t> unread_;
+                std::endian endianness_{std::endian::native};
+                std::optional<packet> packet_;
+            };
+
+            /// <summary>
+            /// Checks that "file" starts with a Section Header Block. Throws a std::invalid_argument if it does not.
+            /// </summary>
+            /// <param name="file">The contents of the file</param>
+            explicit ng_reader (std::span<const uint8_t> file);
+
+            iterator begin (void) const noexcept { return iterator{blocks_}; }
+            std::default_sentinel_t end (void) const noexcept { return std::default_sentinel; }
+
+        private:
+            std::span<const uint8_t> blocks_;
+        };
+
+
+        inline reader::reader (std::span<const uint8_t> file)
+        {
+            if (static constexpr auto minimum_buffer_length{deserialization_length<file_header>()}; file.size() < minimum_buffer_length) {
+                throw std::length_error{std::format ("impossible to read the pcap file header; Required bytes: {}; available bytes: {}",
+                                                     minimum_buffer_length, file.size())};
+            }
+
+            // The magic number reads as one of the known values in the endianness of the file
+            const auto known{[] (uint32_t number) { return (number == pcap_helpers::microsecond_magic) || (number == pcap_helpers::nanosecond_magic); }};
+            auto little_magic{file};
+            auto big_magic{file};
+            if (known (pcap_helpers::deserialize<uint32_t> (little_magic, std::endian::little))) {
+                endianness_ = std::endian::little;
+            }
+            else if (const auto number{pcap_helpers::deserialize<uint32_t> (big_magic, std::endian::big)}; known (number)) {
+                endianness_ = std::endian::big;
+            }
+            else {
+                throw std::invalid_argument{std::format ("unknown pcap magic number: {:#010x}", number)};
+            }
+
+            records_ = file;
+            header_ = pcap_helpers::deserialize<file_header> (records_, endianness_);
+        }
+
+        inline ng_reader::ng_reader (std::span<const uint8_t> file)
+            : blocks_{file}
+        {
+            auto type{file};
+            if ((file.size() < deserialization_length<block_header>()) ||
+                (pcap_helpers::deserialize<uint32_t> (type, std::endian::big) != pcap_helpers::section_header_block)) {
+                throw std::invalid_argument{"a pcapng file must start with a Section Header Block"};
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <span>
+#include <stdexcept>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    namespace batch_helpers
+    {
+        // Packets ahead of the one being decoded whose first bytes are prefetched
+        inline constexpr size_t default_prefetch_distance{8U};
+
+        // Hints that the cache lines holding [data, data + length) will be read soon
+        template<concepts::byte_like B> inline void prefetch (B * data, size_t length) noexcept
+        {
+            const auto first{static_cast<const void *> (data)};
+            const auto last{static_cast<const void *> (data + (length - 1U))};
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch (first, 0, 3);
+            __builtin_prefetch (last, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_prefetch (static_cast<const char *> (first), _MM_HINT_T0);
+            _mm_prefetch (static_cast<const char *> (last), _MM_HINT_T0);
+#else
+            (void) first;
+            (void) last;
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Deserializes an object of type T from the start of every packet in "packets", e.g. the same stack of headers from a burst of packet
+    /// buffers scattered across a buffer pool, to the element of "out" at the same index.
+    /// While a packet is decoded, the first bytes of the packet prefetch_distance positions ahead are prefetched, so that the cache misses
+    /// on different packets overlap; a distance of 0 disables prefetching.
+    /// Throws a std::length_error, before decoding any packet, if "out" is shorter than "packets" or a packet is shorter than the object.
+    /// </summary>
+    /// <typeparam name="T">The type of the object to deserialize from every packet</typeparam>
+    /// <typeparam name="E">The endianness of the objects</typeparam>
+    /// <param name="packets">The packets</param>
+    /// <param name="out">The objects, one per packet</param>
+    /// <param name="prefetch_distance">How many packets ahead of the one being decoded to prefetch</param>
+    template<concepts::fixed_length T, std::endian E, concepts::byte_like B>
+    void deserialize_batch (std::span<const std::span<B>> packets, std::span<T> out, size_t prefetch_distance = batch_helpers::default_prefetch_distance)
+    {
+        constexpr auto length{deserialization_length<T>()};
+        static_assert(length > 0U, "the objects of a batch must not be empty");
+
+        if (out.size() < packets.size()) {
+            throw std::length_error{std::format ("impossible to deserialize {} packets to {} objects", packets.size(), out.size())};
+        }
+        if (const auto short_packet{std::ranges::find_if (packets, [] (std::span<B> packet) { return packet.size() < length; })}; short_packet != packets.end()) {
+            throw std::length_error{std::format ("impossible to deserialize the requested object from packet {}; Required bytes: {}; available bytes: {}",
+                                                  short_packet - packets.begin(), length, short_packet->size())};
+        }
+
+        const auto count{packets.size()};
+        const auto ahead{std::min (prefetch_distance, count)};
+        for (size_t i{0U}; i < ahead; ++i) {
+            batch_helpers::prefetch (packets[i].data(), length);
+        }
+
+        size_t i{0U};
+        if (prefetch_distance > 0U) {
+            for (; (i + prefetch_distance) < count; ++i) {
+                batch_helpers::prefetch (packets[i + prefetch_distance].data(), length);
+                out[i] = deserialize_at<T, E> (packets[i].data());
+            }
+        }
+        for (; i < count; ++i) {
+            out[i] = deserialize_at<T, E> (packets[i].data());
+        }
+    }
+}
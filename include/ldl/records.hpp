@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <bit>
+#include <compare>
+#include <iterator>
+#include <ranges>
+#include <span>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// A random-access view of back-to-back records of type T, whose length is known at compile time.
+    /// Elements are decoded on access, at offset i * deserialization_length&lt;T&gt;() for the i-th record, so that algorithms may
+    /// split the input or visit only some of the records without a pre-scan. Bytes past the last whole record are not part of the view.
+    /// Iterators return records by value: they model std::random_access_iterator, but only the Cpp17 InputIterator requirements;
+    /// for the parallel algorithms of &lt;execution&gt;, which require Cpp17 forward iterators, iterate over the indices and use operator[].
+    /// </summary>
+    template<typename T, std::endian E, concepts::byte_like B> class records_view : public std::ranges::view_interface<records_view<T, E, B>>
+    {
+        static_assert(concepts::fixed_length<T>, "back-to-back records must have a length known at compile time");
+        static_assert(deserialization_length<T>() > 0U, "back-to-back records must not be empty");
+
+        static constexpr auto record_length{static_cast<std::ptrdiff_t> (deserialization_length<T>())};
+
+    public:
+        class iterator
+        {
+        public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator (void) = default;
+            constexpr explicit iterator (B * data) noexcept : data_{data} { }
+
+            constexpr T operator* (void) const { return deserialize_at<T, E> (data_); }
+            constexpr T operator[] (difference_type n) const { return deserialize_at<T, E> (data_ + (n * record_length)); }
+
+            constexpr iterator & operator++ (void) noexcept { data_ += record_length; return *this; }
+            constexpr iterator operator++ (int) noexcept { auto previous{*this}; ++*this; return previous; }
+            constexpr iterator & operator-- (void) noexcept { data_ -= record_length; return *this; }
+            constexpr iterator operator-- (int) noexcept { auto previous{*this}; --*this; return previous; }
+            constexpr iterator & operator+= (difference_type n) noexcept { data_ += n * record_length; return *this; }
+            constexpr iterator & operator-= (difference_type n) noexcept { data_ -= n * record_length; return *this; }
+
+            friend constexpr iterator operator+ (iterator it, difference_type n) noexcept { return it += n; }
+            friend constexpr iterator operator+ (difference_type n, iterator it) noexcept { return it += n; }
+            friend constexpr iterator operator- (iterator it, difference_type n) noexcept { return it -= n; }
+            friend constexpr difference_type operator- (const iterator & lhs, const iterator & rhs) noexcept { return (lhs.data_ - rhs.data_) / record_length; }
+
+            friend constexpr bool operator== (const iterator & lhs, const iterator & rhs) noexcept { return lhs.data_ == rhs.data_; }
+            friend constexpr auto operator<=> (const iterator & lhs, const iterator & rhs) noexcept { return lhs.data_ <=> rhs.data_; }
+
+        private:
+            B * data_{nullptr};
+        };
+
+        constexpr records_view (void) = default;
+        template<size_t N> constexpr explicit records_view (std::span<B, N> buffer) noexcept
+            : data_{buffer.data()}, size_{buffer.size() / static_cast<size_t> (record_length)}
+        { }
+
+        constexpr iterator begin (void) const noexcept { return iterator{data_}; }
+        constexpr iterator end (void) const noexcept { return iterator{data_} + static_cast<std::ptrdiff_t> (size_); }
+        /// <summary>
+        /// Returns the number of whole records in the buffer.
+        /// </summary>
+        constexpr size_t size (void) const noexcept { return size_; }
+        /// <summary>
+        /// Decodes and returns the record at the specified index. The behavior is undefined if the index is not less than size().
+        /// </summary>
+        constexpr T operator[] (size_t index) const { return deserialize_at<T, E> (data_ + (index * static_cast<size_t> (record_length))); }
+
+    private:
+        B * data_{nullptr};
+        size_t size_{0U};
+    };
+
+    /// <summary>
+    /// Returns a random-access view of the back-to-back records of type T in the buffer, decoded on access.
+    /// </summary>
+    /// <typeparam name="T">The type of the records</typeparam>
+    /// <typeparam name="E">The endianness of the records</typeparam>
+    /// <param name="buffer">The buffer that holds the records</param>
+    template<typename T, std::endian E, concepts::byte_like B, size_t N> constexpr records_view<T, E, B> records (std::span<B, N> buffer) noexcept
+    { return records_view<T, E, B>{buffer}; }
+}
+
+namespace std::ranges
+{
+    template<typename T, std::endian E, typename B> inline constexpr bool enable_borrowed_range<little_deserialization_library::records_view<T, E, B>> = true;
+}
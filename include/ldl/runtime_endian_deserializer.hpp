@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// Deserializes objects from a buffer whose endianness is only known at run time, e.g. from a magic number at its start.
+    /// Holds either an object_deserializer&lt;B, std::endian::big&gt; or an object_deserializer&lt;B, std::endian::little&gt;, chosen once at construction.
+    /// visit() calls a function with the deserializer of the chosen endianness, so that the code inside it is compiled for that endianness only;
+    /// the other member functions forward to the same functions of object_deserializer, selecting the endianness at every call.
+    /// </summary>
+    template<concepts::byte_like B> class runtime_endian_deserializer
+    {
+    public:
+        /// <summary>
+        /// Selects the deserializer for the specified endianness; any value other than std::endian::big selects little endian.
+        /// </summary>
+        /// <param name="buffer">The buffer to deserialize objects from</param>
+        /// <param name="endianness">The endianness of the objects in the buffer</param>
+        template<size_t N> constexpr runtime_endian_deserializer (std::span<B, N> buffer, std::endian endianness) noexcept
+            : deserializer_{(endianness == std::endian::big) ? variant_type{std::in_place_index<0U>, std::span<B>{buffer}}
+                                                             : variant_type{std::in_place_index<1U>, std::span<B>{buffer}}}
+        { }
+
+        /// <summary>
+        /// Returns the endianness selected at construction.
+        /// </summary>
+        constexpr std::endian endianness (void) const noexcept { return (deserializer_.index() == 0U) ? std::endian::big : std::endian::little; }
+
+        /// <summary>
+        /// Calls "visitor" with a reference to the object_deserializer of the selected endianness, and returns its result.
+        /// The visitor is instantiated for both endiannesses, and its result type must be the same for both.
+        /// </summary>
+        /// <param name="visitor">A callable that accepts an object_deserializer&lt;B, E&gt; &amp; for either endianness</param>
+        template<typename F> constexpr decltype(auto) visit (F && visitor) { return std::visit (std::forward<F> (visitor), deserializer_); }
+
+        /// <summary>
+        /// Constructs one or more objects with data in the buffer, as object_deserializer::deserialize does.
+        /// </summary>
+        template<typename T, typename... Ts> auto deserialize (void)
+        { return visit ([] (auto & deserializer) { return deserializer.template deserialize<T, Ts...>(); }); }
+        /// <summary>
+        /// Constructs one or more objects with data in the buffer, without length checks, as object_deserializer::deserialize_noexcept does.
+        /// </summary>
+        template<typename T, typename... Ts> auto deserialize_noexcept (void) noexcept((concepts::non_allocating<T> && ... && concepts::non_allocating<Ts>))
+        { return visit ([] (auto & deserializer) { return deserializer.template deserialize_noexcept<T, Ts...>(); }); }
+        /// <summary>
+        /// Constructs an object of type T with data in the buffer, without throwing, as object_deserializer::try_deserialize does.
+        /// </summary>
+        template<typename T> result<T> try_deserialize (void) noexcept(concepts::non_allocating<T>)
+        { return visit ([] (auto & deserializer) { return deserializer.template try_deserialize<T>(); }); }
+        /// <summary>
+        /// Deserializes "count" back-to-back records of type T to "out", as object_deserializer::deserialize_n does.
+        /// </summary>
+        template<typename T, std::output_iterator<T> O> O deserialize_n (size_t count, O out)
+        { return visit ([count, out] (auto & deserializer) { return deserializer.template deserialize_n<T> (count, out); }); }
+        /// <summary>
+        /// Advances the position in the buffer by the specified number of bytes, as object_deserializer::skip does.
+        /// </summary>
+        void skip (size_t bytes) { visit ([bytes] (auto & deserializer) { deserializer.skip (bytes); }); }
+        /// <summary>
+        /// Advances the position in the buffer by the deserialization length of type T, as object_deserializer::skip does.
+        /// </summary>
+        template<typename T> void skip (void) { visit ([] (auto & deserializer) { deserializer.template skip<T>(); }); }
+        /// <summary>
+        /// Advances the position in the buffer by the specified number of bytes, without throwing, as object_deserializer::try_skip does.
+        /// </summary>
+        result<void> try_skip (size_t bytes) noexcept { return visit ([bytes] (auto & deserializer) noexcept { return deserializer.try_skip (bytes); }); }
+
+        /// <summary>
+        /// Returns a std::span over the first "size" bytes of the unread part of the buffer, or the whole buffer, whichever is smaller.
+        /// </summary>
+        constexpr std::span<B> get_unread_buffer (size_t size = std::numeric_limits<size_t>::max()) const
+        { return std::visit ([size] (const auto & deserializer) { return deserializer.get_unread_buffer (size); }, deserializer_); }
+
+    private:
+        using variant_type = std::variant<object_deserializer<B, std::endian::big>, object_deserializer<B, std::endian::little>>;
+
+        variant_type deserializer_;
+    };
+}
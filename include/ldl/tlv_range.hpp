@@ -0,0 +1,235 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+
+#include "helpers/ldl_isa.hpp"
+#include "object_deserializer.hpp"
+
+
+namespace little_deserialization_library::inline LDL_ISA_NAMESPACE
+{
+    /// <summary>
+    /// How the elements of a type-length-value sequence are laid out, beyond the widths of their type and length fields.
+    /// </summary>
+    struct tlv_layout
+    {
+        // Whether the length counts the type and length fields too, as in TCP and IPv4 options, rather than the value only
+        bool length_includes_header{false};
+        // Types whose elements are made of the type field only, e.g. the No-Operation option of TCP
+        std::array<uint64_t, 2U> type_only{};
+        size_t type_only_count{0U};
+        // The type that ends the sequence, if any; the bytes that follow it are padding
+        bool has_end{false};
+        uint64_t end{0U};
+    };
+
+    namespace tlv_layouts
+    {
+        /// <summary>
+        /// TCP options (RFC 9293) and IPv4 options (RFC 791): End of Option List (0) ends the sequence, and No-Operation (1) has no length.
+        /// </summary>
+        inline constexpr tlv_layout tcp_options{.length_includes_header = true, .type_only = {1U}, .type_only_count = 1U, .has_end = true, .end = 0U};
+        inline constexpr tlv_layout ipv4_options{tcp_options};
+        /// <summary>
+        /// DHCP options (RFC 2132): Pad (0) has no length, and End (255) ends the sequence.
+        /// </summary>
+        inline constexpr tlv_layout dhcp_options{.type_only = {0U}, .type_only_count = 1U, .has_end = true, .end = 255U};
+        /// <summary>
+        /// The options of the IPv6 Hop-by-Hop and Destination Options headers (RFC 8200): Pad1 (0) has no length.
+        /// </summary>
+        inline constexpr tlv_layout ipv6_options{.type_only = {0U}, .type_only_count = 1U};
+    }
+
+    /// <summary>
+    /// An element of a type-length-value sequence: its type, and a view of its value in the buffer.
+    /// </summary>
+    template<concepts::non_bool_integral TypeT, std::endian E, concepts::byte_like B> struct tlv_element
+    {
+        /// <summary>
+        /// Decodes the value as the alternative among Cases selected by the type, e.g. on&lt;2, mss_option&gt;.
+        /// Returns std::monostate, without reading the value, if no alternative matches the type, or if the value is too short for the selected one.
+        /// </summary>
+        /// <typeparam name="Cases">The known types, as specializations of on&lt;Key, T&gt;</typeparam>
+        template<typename... Cases> requires(sizeof...(Cases) > 0U) variant_of<Cases...> decode (void) const
+        {
+            // Known types are matched by a chain of comparisons, which the compiler may turn into a jump table: for the few types
+            // of an option list, this is faster than the perfect hash and the tables of function pointers of variant_on
+            variant_of<Cases...> decoded;
+            const auto key{static_cast<uint64_t> (type)};
+            [this, key, &decoded] <size_t... Alts> (std::index_sequence<Alts...>) {
+                (void) ((... || ((key == static_cast<uint64_t> (Cases::key)) && [this, &decoded] {
+                    using T = Cases::type;
+                    if (deserialization_length_at<T, E> (value.data(), value.size()) <= value.size()) {
+                        decoded.template emplace<Alts + 1U> (deserialize_at<T, E> (value.data()));
+                    }
+                    return true;
+                } ())));
+            } (std::index_sequence_for<Cases...>());
+
+            return decoded;
+        }
+
+
+        TypeT type;
+        std::span<B> value;
+    };
+
+    namespace tlv_helpers
+    {
+        template<tlv_layout Layout> constexpr bool is_type_only (uint64_t type) noexcept
+        {
+            for (size_t i{0U}; i < Layout.type_only_count; ++i) {
+                if (Layout.type_only[i] == type) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Returns the element at the front of "unread" and moves past it, or nothing, leaving "unread" as it is,
+        // at the end of the sequence or if the element is truncated or its length is invalid
+        template<typename TypeT, typename LenT, std::endian E, tlv_layout Layout, concepts::byte_like B>
+            constexpr std::optional<tlv_element<TypeT, E, B>> next_element (std::span<B> & unread) noexcept
+        {
+            constexpr auto header_length{sizeof(TypeT) + sizeof(LenT)};
+
+            if (unread.size() < sizeof(TypeT)) {
+                return std::nullopt;
+            }
+            const auto type{reader::read<TypeT, E> (unread.data())};
+            if (Layout.has_end && (static_cast<uint64_t> (type) == Layout.end)) {
+                return std::nullopt;
+            }
+            if (is_type_only<Layout> (static_cast<uint64_t> (type))) {
+                const tlv_element<TypeT, E, B> element{type, unread.subspan (sizeof(TypeT), 0U)};
+                unread = unread.subspan (sizeof(TypeT));
+                return element;
+            }
+
+            if (unread.size() < header_length) {
+                return std::nullopt;
+            }
+            auto value_length{static_cast<size_t> (reader::read<LenT, E> (unread.data() + sizeof(TypeT)))};
+            if constexpr (Layout.length_includes_header) {
+                if (value_length < header_length) {
+                    return std::nullopt;
+                }
+                value_length -= header_length;
+            }
+            if (value_length > (unread.size() - header_length)) {
+                return std::nullopt;
+            }
+
+            const tlv_element<TypeT, E, B> element{type, unread.subspan (header_length, value_length)};
+            unread = unread.subspan (header_length + value_length);
+            return element;
+        }
+    }
+
+    /// <summary>
+    /// A view of the elements of a type-length-value sequence, e.g. the options that follow a TCP header, decoded lazily as it is iterated.
+    /// Every element is a tlv_element holding its type and a std::span over its value: no byte is copied.
+    /// Iteration stops at the end type of the layout, at the end of the buffer, or at the first truncated element, or whose length is invalid;
+    /// well_formed() tells whether the whole buffer was consumed.
+    /// </summary>
+    /// <typeparam name="TypeT">The integral type of the type field</typeparam>
+    /// <typeparam name="LenT">The unsigned integral type of the length field</typeparam>
+    /// <typeparam name="E">The endianness of the type and length fields, and of the values decoded through tlv_element::decode</typeparam>
+    /// <typeparam name="Layout">The tlv_layout of the sequence, e.g. tlv_layouts::tcp_options</typeparam>
+    template<concepts::non_bool_integral TypeT, std::unsigned_integral LenT, std::endian E, concepts::byte_like B, tlv_layout Layout = tlv_layout{}>
+        class tlv_range : public std::ranges::view_interface<tlv_range<TypeT, LenT, E, B, Layout>>
+    {
+    public:
+        using element = tlv_element<TypeT, E, B>;
+
+        class iterator
+        {
+        public:
+            using value_type = element;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator (void) = default;
+            constexpr explicit iterator (std::span<B> elements) noexcept
+                : unread_{elements}, element_{tlv_helpers::next_element<TypeT, LenT, E, Layout> (unread_)}
+            { }
+
+            constexpr const element & operator* (void) const noexcept { return *element_; }
+            constexpr const element * operator-> (void) const noexcept { return &*element_; }
+            constexpr iterator & operator++ (void) noexcept
+            {
+                element_ = tlv_helpers::next_element<TypeT, LenT, E, Layout> (unread_);
+                return *this;
+            }
+            constexpr iterator operator++ (int) noexcept
+            {
+                auto previous{*this};
+                ++*this;
+                return previous;
+            }
+            friend constexpr bool operator== (const iterator & it, std::default_sentinel_t) noexcept { return !it.element_.has_value(); }
+
+        private:
+            std::span<B> unread_;
+            std::optional<element> element_;
+        };
+
+        constexpr tlv_range (void) = default;
+        template<size_t N> constexpr explicit tlv_range (std::span<B, N> elements) noexcept : elements_{elements} { }
+
+        constexpr iterator begin (void) const noexcept { return iterator{elements_}; }
+        constexpr std::default_sentinel_t end (void) const noexcept { return std::default_sentinel; }
+
+        /// <summary>
+        /// Returns the first element of the specified type, or nothing if iteration stops before finding one.
+        /// </summary>
+        constexpr std::optional<element> find (TypeT type) const noexcept
+        {
+            for (const auto & candidate : *this) {
+                if (candidate.type == type) {
+                    return candidate;
+                }
+            }
+            return std::nullopt;
+        }
+
+        /// <summary>
+        /// Whether iteration consumes the whole buffer, or stops at the end type of the layout, rather than at a truncated or invalid element.
+        /// </summary>
+        constexpr bool well_formed (void) const noexcept
+        {
+            auto unread{elements_};
+            while (tlv_helpers::next_element<TypeT, LenT, E, Layout> (unread).has_value()) { }
+
+            return unread.empty() || (Layout.has_end && (unread.size() >= sizeof(TypeT)) &&
+                                      (static_cast<uint64_t> (reader::read<TypeT, E> (unread.data())) == Layout.end));
+        }
+
+    private:
+        std::span<B> elements_;
+    };
+
+    /// <summary>
+    /// Returns a view of the elements of the type-length-value sequence in the buffer, e.g. get_unread_buffer() after a fixed header.
+    /// </summary>
+    /// <typeparam name="TypeT">The integral type of the type field</typeparam>
+    /// <typeparam name="LenT">The unsigned integral type of the length field</typeparam>
+    /// <typeparam name="E">The endianness of the fields</typeparam>
+    /// <typeparam name="Layout">The tlv_layout of the sequence</typeparam>
+    /// <param name="elements">The buffer that holds the sequence</param>
+    template<typename TypeT, typename LenT, std::endian E, tlv_layout Layout = tlv_layout{}, concepts::byte_like B, size_t N>
+        constexpr tlv_range<TypeT, LenT, E, B, Layout> tlv (std::span<B, N> elements) noexcept
+    { return tlv_range<TypeT, LenT, E, B, Layout>{elements}; }
+}
+
+namespace std::ranges
+{
+    template<typename TypeT, typename LenT, std::endian E, typename B, little_deserialization_library::tlv_layout Layout>
+        inline constexpr bool enable_borrowed_range<little_deserialization_library::tlv_range<TypeT, LenT, E, B, Layout>> = true;
+}
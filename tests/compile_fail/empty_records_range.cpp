@@ -0,0 +1,25 @@
+// expected error: back-to-back records must not be empty
+
+#include <array>
+#include <cstdint>
+
+#include "ldl/records.hpp"
+
+
+struct empty_record { };
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<empty_record>
+    {
+        using type = std::tuple<skip<0U>>;
+    };
+}
+
+int main (void)
+{
+    namespace ldl = little_deserialization_library;
+
+    const std::array<uint8_t, 4U> bytes{};
+    return static_cast<int> (ldl::records<empty_record, std::endian::big> (std::span{bytes}).size());
+}
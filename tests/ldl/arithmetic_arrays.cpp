@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "ldl/object_deserializer.hpp"
+
+
+struct sample_block
+{
+    uint16_t channel;
+    std::array<uint32_t, 3U> samples;
+};
+
+struct routing_table
+{
+    std::array<uint64_t, 40U> routes;   // 320 bytes: converted by the bulk kernel
+};
+
+struct sample_history
+{
+    uint16_t channel;
+    std::array<uint32_t, 20U> samples;  // 84 bytes, with padding after channel
+};
+
+struct calibration
+{
+    constexpr explicit calibration (const float (&gains)[2], const int16_t (&offsets)[2]) noexcept :
+        gains{gains[0], gains[1]}, offsets{offsets[0], offsets[1]} { }
+
+
+    float gains[2];
+    int16_t offsets[2];
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<sample_block>
+    {
+        using type = std::tuple<uint16_t, std::array<uint32_t, 3U>>;
+    };
+
+    template<> struct rule<routing_table>
+    {
+        using type = std::tuple<std::array<uint64_t, 40U>>;
+    };
+
+    template<> struct rule<sample_history>
+    {
+        using type = std::tuple<uint16_t, std::array<uint32_t, 20U>>;
+    };
+
+    template<> struct rule<calibration>
+    {
+        using type = std::tuple<float[2], const int16_t[2]>;
+    };
+}
+
+// std::array of multi-byte elements, big-endian and little-endian
+TEST(ArithmeticArrayTest, ShortStdArray) {
+
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t bytes[] = {
+        0x00, 0x07,                         // channel
+        0x00, 0x00, 0x00, 0x01,             // samples[0]
+        0x12, 0x34, 0x56, 0x78,             // samples[1]
+        0xFF, 0xFF, 0xFF, 0xFE              // samples[2]
+    };
+
+    ASSERT_EQ(ldl::deserialization_length<sample_block>(), 14U);
+
+    ldl::network_packet_deserializer big_endian{std::span{bytes}};
+    const auto big{big_endian.deserialize<sample_block>()};
+    ASSERT_EQ(big.channel, 7U);
+    ASSERT_EQ(big.samples, (std::array<uint32_t, 3U>{0x00000001U, 0x12345678U, 0xFFFFFFFEU}));
+    ASSERT_TRUE(big_endian.get_unread_buffer().empty());
+
+    ldl::object_deserializer<const uint8_t, std::endian::little> little_endian{std::span{bytes}};
+    const auto little{little_endian.deserialize<sample_block>()};
+    ASSERT_EQ(little.channel, 0x0700U);
+    ASSERT_EQ(little.samples, (std::array<uint32_t, 3U>{0x01000000U, 0x78563412U, 0xFEFFFFFFU}));
+}
+
+// Long std::array, converted by the bulk kernel
+TEST(ArithmeticArrayTest, LongStdArray) {
+
+    namespace ldl = little_deserialization_library;
+
+    std::vector<uint8_t> bytes;
+    for (uint64_t route{0U}; route < 40U; ++route) {
+        for (int shift{56}; shift >= 0; shift -= 8) {
+            bytes.push_back (static_cast<uint8_t> ((route * 0x0101010101010101ULL) >> shift));
+        }
+    }
+
+    ldl::network_packet_deserializer deserializer{std::span{bytes}};
+    const auto table{deserializer.deserialize<routing_table>()};
+    for (uint64_t route{0U}; route < 40U; ++route) {
+        ASSERT_EQ(table.routes[route], route * 0x0101010101010101ULL);
+    }
+}
+
+// Built-in arrays of floating point and signed elements
+TEST(ArithmeticArrayTest, BuiltInArray) {
+
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t bytes[] = {
+        0x3F, 0x80, 0x00, 0x00,             // 1.0f
+        0xC0, 0x00, 0x00, 0x00,             // -2.0f
+        0xFF, 0xFE,                         // -2
+        0x01, 0x00                          // 256
+    };
+
+    ASSERT_EQ(ldl::deserialization_length<calibration>(), 12U);
+
+    ldl::network_packet_deserializer deserializer{std::span{bytes}};
+    const auto values{deserializer.deserialize<calibration>()};
+    ASSERT_EQ(values.gains[0], 1.0f);
+    ASSERT_EQ(values.gains[1], -2.0f);
+    ASSERT_EQ(values.offsets[0], -2);
+    ASSERT_EQ(values.offsets[1], 256);
+}
+
+// Large records written to a contiguous range of another value type are assigned, not constructed over its elements
+TEST(ArithmeticArrayTest, ContiguousOutputOfAnotherType) {
+
+    namespace ldl = little_deserialization_library;
+
+    std::vector<uint8_t> bytes;
+    for (uint16_t channel{1U}; channel <= 2U; ++channel) {
+        bytes.push_back (0x00);
+        bytes.push_back (static_cast<uint8_t> (channel));
+        for (uint32_t sample{0U}; sample < 20U; ++sample) {
+            bytes.insert (bytes.end(), {0x00, 0x00, static_cast<uint8_t> (channel), static_cast<uint8_t> (sample)});
+        }
+    }
+
+    ldl::network_packet_deserializer deserializer{std::span{bytes}};
+    std::vector<std::optional<sample_history>> histories(3U);
+    deserializer.deserialize_n<sample_history> (2U, histories.begin());
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+    for (uint16_t channel{1U}; channel <= 2U; ++channel) {
+        const auto & history{histories[channel - 1U]};
+        ASSERT_TRUE(history.has_value());
+        ASSERT_EQ(history->channel, channel);
+        for (uint32_t sample{0U}; sample < 20U; ++sample) {
+            ASSERT_EQ(history->samples[sample], (uint32_t{channel} << 8U) | sample);
+        }
+    }
+    ASSERT_FALSE(histories[2U].has_value());
+}
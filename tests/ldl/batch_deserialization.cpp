@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+// Back-to-back copies of the IPv4 header of eth_ip_tcp_packet
+static std::vector<uint8_t> ip_header_run (size_t count)
+{
+    const auto ip_bytes{std::span{eth_ip_tcp_packet}.subspan<14U, 20U>()};
+
+    std::vector<uint8_t> run;
+    for (size_t i{0U}; i < count; ++i) {
+        run.insert (run.end(), ip_bytes.begin(), ip_bytes.end());
+    }
+
+    return run;
+}
+
+// deserialize_n writes every record and advances the buffer once
+TEST(BatchDeserializationTest, DeserializeN) {
+
+    namespace ldl = little_deserialization_library;
+
+    // 7 records: one unrolled block of 4 plus a tail of 3
+    const auto run{ip_header_run (7U)};
+    ldl::network_packet_deserializer deserializer{std::span{run}};
+    std::vector<ip_header> headers;
+    deserializer.deserialize_n<ip_header> (7U, std::back_inserter (headers));
+    ASSERT_EQ(headers.size(), 7U);
+    for (const auto & ip_packet : headers) {
+        ASSERT_EQ(format_ip_address (ip_packet.src_ip), "192.168.1.100");
+        ASSERT_EQ(format_ip_address (ip_packet.dest_ip), "192.168.1.1");
+        ASSERT_EQ(ip_packet.identification, 6699U);
+        ASSERT_EQ(ip_packet.ttl, 64U);
+    }
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+}
+
+// deserialize_into fills the whole destination span and leaves the rest of the buffer unread
+TEST(BatchDeserializationTest, DeserializeInto) {
+
+    namespace ldl = little_deserialization_library;
+
+    const auto run{ip_header_run (5U)};
+    ldl::network_packet_deserializer deserializer{std::span{run}};
+    ip_header headers[4];
+    deserializer.deserialize_into<ip_header> (headers);
+    for (const auto & ip_packet : headers) {
+        ASSERT_EQ(format_ip_address (ip_packet.src_ip), "192.168.1.100");
+        ASSERT_EQ(ip_packet.protocol, 6U);
+    }
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), deserializer.deserialization_length<ip_header>());
+
+    deserializer.deserialize_into<ip_header> (std::span<ip_header>{});
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), deserializer.deserialization_length<ip_header>());
+}
+
+// A run that does not fit in the buffer throws before anything is read
+TEST(BatchDeserializationTest, DeserializeNException) {
+
+    namespace ldl = little_deserialization_library;
+
+    const auto run{ip_header_run (3U)};
+    ldl::network_packet_deserializer deserializer{std::span{run}};
+    std::vector<ip_header> headers;
+    ASSERT_THROW(deserializer.deserialize_n<ip_header> (4U, std::back_inserter (headers)), std::length_error);
+    ASSERT_TRUE(headers.empty());
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), run.size());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// IPv4 header whose packed fields are split into separate members
+struct ip_header_unpacked
+{
+    uint8_t  version;
+    uint8_t  ihl;
+    uint8_t  dscp;
+    uint8_t  ecn;
+    uint16_t total_length;
+    uint16_t identification;
+    uint8_t  flags;
+    uint16_t frag_offset;
+    uint8_t  ttl;
+    uint8_t  protocol;
+    uint16_t checksum;
+    uint32_t src_ip;
+    uint32_t dest_ip;
+};
+
+// The packed fields of a TCP header, after the ports and the sequence numbers
+struct tcp_control
+{
+    uint8_t  data_offset;
+    uint8_t  reserved;
+    uint16_t flags;
+    uint16_t window_size;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header_unpacked>
+    {
+        using type = std::tuple<bits<uint8_t, 4U, 4U>, bits<uint8_t, 6U, 2U>, uint16_t, uint16_t, bits<uint16_t, 3U, 13U>,
+                                uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_control>
+    {
+        using type = std::tuple<skip<12U>, bits<uint16_t, 4U, 3U, 9U>, uint16_t, skip<4U>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+TEST(BitFieldsTest, Extraction) {
+
+    static_assert(ldl::bits<uint16_t, 3U, 13U>{0xBFFFU}.get<0>() == 0x5U);
+    static_assert(ldl::bits<uint16_t, 3U, 13U>{0xBFFFU}.get<1>() == 0x1FFFU);
+    static_assert(std::is_same_v<decltype(ldl::bits<uint32_t, 31U, 1U>{}.get<0>()), uint32_t>);
+    static_assert(std::is_same_v<decltype(ldl::bits<uint32_t, 31U, 1U>{}.get<1>()), uint8_t>);
+    static_assert(ldl::bits<uint64_t, 64U>{0xFFFFFFFFFFFFFFFFU}.get<0>() == 0xFFFFFFFFFFFFFFFFU);
+}
+
+// Bit fields count toward the deserialization length with the size of their word
+TEST(BitFieldsTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<ldl::bits<uint16_t, 3U, 13U>>() == 2U);
+    static_assert(ldl::deserialization_length<ip_header_unpacked>() == 20U);
+    static_assert(ldl::deserialization_length<tcp_control>() == 20U);
+}
+
+// Every bit field of a word becomes a separate member
+TEST(BitFieldsTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_opt_tcp_seg_packet}};
+    deserializer.skip (14U);
+    const auto ip_packet = deserializer.deserialize<ip_header_unpacked>();
+    ASSERT_EQ(ip_packet.version, 4U);
+    ASSERT_EQ(ip_packet.ihl, 6U);
+    ASSERT_EQ(ip_packet.dscp, 0U);
+    ASSERT_EQ(ip_packet.ecn, 0U);
+    ASSERT_EQ(ip_packet.total_length, 60U);
+    ASSERT_EQ(ip_packet.flags, 0x2U);
+    ASSERT_EQ(ip_packet.frag_offset, 0U);
+    ASSERT_EQ(ip_packet.protocol, 0x06U);
+    ASSERT_EQ(format_ip_address (ip_packet.dest_ip), "192.168.1.1");
+
+    deserializer.skip ((ip_packet.ihl * 4U) - ldl::deserialization_length<ip_header_unpacked>());
+    const auto control = deserializer.deserialize<tcp_control>();
+    ASSERT_EQ(control.data_offset, 5U);
+    ASSERT_EQ(control.flags, 0x018U);
+    ASSERT_EQ(control.window_size, 0x7110U);
+
+    const auto ip_view = ldl::network_packet_deserializer{std::span{eth_ip_opt_tcp_seg_packet}.subspan<14U>()}.view<ip_header_unpacked>();
+    ASSERT_EQ(ip_view.get<4>().get<0>(), 0x2U);
+}
+
+// Bit fields are extracted after the endian conversion of their word
+TEST(BitFieldsTest, LittleEndian) {
+
+    const uint8_t bytes[] = {0x00, 0x40, 0x45, 0x00, 0x00, 0x34, 0x1A, 0x2B, 0x40, 0x06, 0x00, 0x00, 0xC0, 0xA8, 0x01, 0x64, 0xC0, 0xA8, 0x01, 0x01};
+    ldl::object_deserializer<const uint8_t, std::endian::little> deserializer{std::span{bytes}.subspan<2U>()};
+    const auto [version_ihl, tos, length] = deserializer.deserialize<ldl::bits<uint8_t, 4U, 4U>, uint8_t, uint16_t>();
+    ASSERT_EQ(version_ihl.get<0>(), 4U);
+    ASSERT_EQ(version_ihl.get<1>(), 5U);
+
+    ldl::object_deserializer<const uint8_t, std::endian::little> word_deserializer{std::span{bytes}};
+    const auto flags_offset = word_deserializer.deserialize<ldl::bits<uint16_t, 3U, 13U>>();
+    ASSERT_EQ(flags_offset.get<0>(), 0x2U);
+    ASSERT_EQ(flags_offset.get<1>(), 0U);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/chunked_deserializer.hpp"
+
+
+struct mac_view
+{
+    std::span<const uint8_t, 6U> address;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<mac_view>
+    {
+        using type = std::tuple<std::span<const uint8_t, 6U>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // Splits the bytes into chunks that end at the given offsets
+    std::vector<std::span<const uint8_t>> split (std::span<const uint8_t> bytes, std::initializer_list<size_t> ends)
+    {
+        std::vector<std::span<const uint8_t>> chunks;
+        size_t begin{0U};
+        for (const auto end : ends) {
+            chunks.push_back (bytes.subspan (begin, end - begin));
+            begin = end;
+        }
+        chunks.push_back (bytes.subspan (begin));
+
+        return chunks;
+    }
+}
+
+TEST(ChunkedDeserializationTest, SelfContained) {
+
+    static_assert(ldl::concepts::self_contained<ip_header>);
+    static_assert(ldl::concepts::self_contained<std::array<uint32_t, 4U>>);
+    static_assert(!ldl::concepts::self_contained<mac_view>);
+    static_assert(!ldl::concepts::self_contained<const uint8_t[6]>);
+}
+
+// Headers are deserialized in place or stitched, with the same result
+TEST(ChunkedDeserializationTest, FieldsExtraction) {
+
+    // The Ethernet header lies in the first chunk, the IP header crosses two boundaries and an empty chunk, the TCP header crosses one
+    const auto chunks{split (std::span{eth_ip_tcp_packet}, {14U, 17U, 17U, 18U, 40U})};
+    ldl::chunked_deserializer<const uint8_t, std::endian::big> deserializer{std::span{chunks}};
+    ASSERT_EQ(deserializer.available(), sizeof(eth_ip_tcp_packet));
+
+    const auto ether_frame = deserializer.deserialize<eth_header>();
+    ASSERT_EQ(ether_frame.ethertype, 0x0800U);
+    const auto ip_packet = deserializer.deserialize<ip_header>();
+    ASSERT_EQ(ip_packet.identification, 6699U);
+    ASSERT_EQ(format_ip_address (ip_packet.src_ip), "192.168.1.100");
+    ASSERT_EQ(format_ip_address (ip_packet.dest_ip), "192.168.1.1");
+    const auto tcp_packet = deserializer.deserialize<tcp_header>();
+    ASSERT_EQ(tcp_packet.seq_number, 305419896U);
+    ASSERT_EQ(tcp_packet.ack_number, 2596069104U);
+    ASSERT_EQ(tcp_packet.window_size, 0x7110U);
+    ASSERT_EQ(deserializer.available(), 0U);
+}
+
+// The two halves of a ring buffer, with the IP header wrapping around its end
+TEST(ChunkedDeserializationTest, RingBuffer) {
+
+    std::array<uint8_t, sizeof(eth_ip_tcp_packet)> ring{};
+    std::ranges::rotate_copy (eth_ip_tcp_packet, std::ranges::next (std::ranges::begin (eth_ip_tcp_packet), 20), ring.begin());
+    const std::array<std::span<const uint8_t>, 2U> halves{std::span{ring}.subspan (34U), std::span{ring}.first (34U)};
+    ldl::chunked_deserializer<const uint8_t, std::endian::big> deserializer{std::span{halves}};
+    deserializer.skip (14U);
+    ASSERT_EQ(deserializer.deserialize<uint32_t>(), 0x45000034U);
+    ASSERT_EQ(deserializer.deserialize<uint16_t>(), 0x1A2BU);
+    deserializer.skip<std::array<uint8_t, 4U>>();
+    ASSERT_EQ(deserializer.available(), 30U);
+
+    ldl::chunked_deserializer<const uint8_t, std::endian::big> rewound{std::span{halves}};
+    rewound.skip<eth_header>();
+    const auto ip_packet = rewound.deserialize<ip_header>();
+    ASSERT_EQ(format_ip_address (ip_packet.dest_ip), "192.168.1.1");
+}
+
+TEST(ChunkedDeserializationTest, Exceptions) {
+
+    const auto chunks{split (std::span{eth_ip_tcp_packet}.first (30U), {10U, 20U})};
+    ldl::chunked_deserializer<const uint8_t, std::endian::big> deserializer{std::span{chunks}};
+    deserializer.skip (14U);
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<ip_header>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_FALSE(deserializer.try_deserialize<ip_header>().has_value());
+    ASSERT_EQ(deserializer.available(), 16U);
+
+    const auto version = deserializer.try_deserialize<uint8_t>();
+    ASSERT_TRUE(version.has_value());
+    ASSERT_EQ(*version, 0x45U);
+    ASSERT_THROW(deserializer.skip (16U), std::length_error);
+}
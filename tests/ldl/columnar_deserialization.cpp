@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+// Back-to-back copies of the IPv4 header of eth_ip_tcp_packet, with identification set to the record index
+static std::vector<uint8_t> ip_header_run (size_t count)
+{
+    const auto ip_bytes{std::span{eth_ip_tcp_packet}.subspan<14U, 20U>()};
+
+    std::vector<uint8_t> run;
+    for (size_t i{0U}; i < count; ++i) {
+        run.insert (run.end(), ip_bytes.begin(), ip_bytes.end());
+        run[(i * ip_bytes.size()) + 4U] = static_cast<uint8_t> (i >> 8);
+        run[(i * ip_bytes.size()) + 5U] = static_cast<uint8_t> (i);
+    }
+
+    return run;
+}
+
+// Only the requested columns are filled
+TEST(ColumnarDeserializationTest, SelectedColumns) {
+
+    namespace ldl = little_deserialization_library;
+
+    // Enough records to exercise the vector kernels and the scalar tail
+    constexpr size_t records{1037U};
+    const auto run{ip_header_run (records)};
+    std::vector<uint16_t> identification(records);
+    std::vector<uint32_t> src_ip(records);
+    std::vector<uint32_t> dest_ip(records);
+
+    ldl::columns_t<ip_header> columns{};
+    std::get<3> (columns) = identification;
+    std::get<8> (columns) = src_ip;
+    std::get<9> (columns) = dest_ip;
+
+    ldl::network_packet_deserializer deserializer{std::span{run}};
+    deserializer.deserialize_columns<ip_header> (records, columns);
+    for (size_t i{0U}; i < records; ++i) {
+        ASSERT_EQ(identification[i], i);
+        ASSERT_EQ(format_ip_address (src_ip[i]), "192.168.1.100");
+        ASSERT_EQ(format_ip_address (dest_ip[i]), "192.168.1.1");
+    }
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+}
+
+// Columns match the fields of the objects decoded one by one, for both byte orders and for array elements
+TEST(ColumnarDeserializationTest, MatchesObjectDeserialization) {
+
+    namespace ldl = little_deserialization_library;
+
+    const auto bytes{std::span{eth_ip_tcp_packet}.first<14U>()};
+    std::array<std::array<uint8_t, 6U>, 1U> dest_mac;
+    std::array<uint16_t, 1U> ethertype;
+
+    ldl::columns_t<eth_header> columns{dest_mac, {}, ethertype};
+    ldl::object_deserializer<const uint8_t, std::endian::little> deserializer{bytes};
+    deserializer.deserialize_columns<eth_header> (1U, columns);
+    const auto eth_frame{ldl::object_deserializer<const uint8_t, std::endian::little>{bytes}.deserialize<eth_header>()};
+    ASSERT_EQ(dest_mac[0], eth_frame.dest_mac);
+    ASSERT_EQ(ethertype[0], eth_frame.ethertype);
+    ASSERT_EQ(ethertype[0], 0x0008U);
+}
+
+// Exceptions on short buffers and short columns
+TEST(ColumnarDeserializationTest, Exceptions) {
+
+    namespace ldl = little_deserialization_library;
+
+    const auto run{ip_header_run (4U)};
+    std::vector<uint32_t> src_ip(3U);
+    ldl::columns_t<ip_header> columns{};
+    std::get<8> (columns) = src_ip;
+
+    ldl::network_packet_deserializer deserializer{std::span{run}};
+    ASSERT_THROW(deserializer.deserialize_columns<ip_header> (5U, columns), std::length_error);
+    ASSERT_THROW(deserializer.deserialize_columns<ip_header> (4U, columns), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), run.size());
+}
+
+// The bulk kernels agree with the scalar reader for every element size and for unaligned tails
+TEST(BulkReaderTest, MatchesScalarReader) {
+
+    namespace ldl = little_deserialization_library;
+
+    std::vector<uint8_t> bytes(8U * 67U);
+    for (size_t i{0U}; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t> ((i * 37U) + 11U);
+    }
+
+    const auto check{[&bytes] <typename T> (void) {
+        for (size_t count{0U}; count <= (bytes.size() / sizeof(T)); ++count) {
+            std::vector<T> values(count);
+            ldl::bulk_reader::read<T, std::endian::big> (bytes.data(), values.data(), count);
+            for (size_t i{0U}; i < count; ++i) {
+                ASSERT_EQ(values[i], (ldl::reader::read<T, std::endian::big> (bytes.data() + (i * sizeof(T)))));
+            }
+        }
+    }};
+    check.template operator()<uint16_t>();
+    check.template operator()<int32_t>();
+    check.template operator()<uint64_t>();
+    check.template operator()<double>();
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// Nested rules, whose fields lie at offsets accumulated across the nesting levels
+struct frame_headers
+{
+    eth_header_composed eth;
+    ip_header ip;
+    tcp_header tcp;
+};
+
+// Spans and arrays between arithmetic fields
+struct mixed_fields
+{
+    uint16_t tag;
+    std::span<const uint8_t, 3U> raw;
+    std::array<uint16_t, 2U> words;
+    uint8_t last;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<mac>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+    };
+
+    template<> struct rule<eth_header_composed>
+    {
+        using type = std::tuple<mac, mac, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<frame_headers>
+    {
+        using type = std::tuple<eth_header_composed, ip_header, tcp_header>;
+    };
+
+    template<> struct rule<mixed_fields>
+    {
+        using type = std::tuple<uint16_t, std::span<const uint8_t, 3U>, std::array<uint16_t, 2U>, uint8_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    static_assert(ldl::deserialization_offset<ldl::deserialization_rules::rule_t<frame_headers>, 1U>() == 14U);
+    static_assert(ldl::deserialization_offset<ldl::deserialization_rules::rule_t<frame_headers>, 2U>() == 34U);
+    static_assert(ldl::deserialization_offset<ldl::deserialization_rules::rule_t<mixed_fields>, 3U>() == 9U);
+}
+
+// Fields of nested rules are read at their absolute offsets, and the span is advanced past the whole object
+TEST(ConstantOffsetDecodingTest, NestedRules) {
+
+    std::span<const uint8_t> packet{eth_ip_tcp_packet};
+    const auto headers{ldl::deserialize<frame_headers, std::endian::big> (packet)};
+    ASSERT_EQ(packet.data(), eth_ip_tcp_packet + 54U);
+    ASSERT_EQ(headers.eth.src_mac, (mac{0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E}));
+    ASSERT_EQ(headers.eth.ethertype, 0x0800U);
+    ASSERT_EQ(headers.ip.identification, 6699U);
+    ASSERT_EQ(headers.ip.src_ip, 0xC0A80164U);
+    ASSERT_EQ(headers.tcp.seq_number, 305419896U);
+    ASSERT_EQ(headers.tcp.window_size, 0x7110U);
+
+    const auto tcp{ldl::deserialize_at<tcp_header, std::endian::big> (eth_ip_tcp_packet + 34U)};
+    ASSERT_EQ(tcp.seq_number, headers.tcp.seq_number);
+    ASSERT_EQ(tcp.urgent_pointer, headers.tcp.urgent_pointer);
+}
+
+TEST(ConstantOffsetDecodingTest, MixedFields) {
+
+    const uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B};
+
+    std::span<const uint8_t> packet{bytes};
+    const auto value{ldl::deserialize<mixed_fields, std::endian::little> (packet)};
+    ASSERT_EQ(packet.size(), 1U);
+    ASSERT_EQ(value.tag, 0x0201U);
+    ASSERT_EQ(value.raw.data(), bytes + 2U);
+    ASSERT_EQ(value.words, (std::array<uint16_t, 2U>{0x0706U, 0x0908U}));
+    ASSERT_EQ(value.last, 0x0AU);
+}
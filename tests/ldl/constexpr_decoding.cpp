@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// An entry of a lookup table, as baked in a binary blob
+struct calibration
+{
+    uint16_t id;
+    std::array<uint32_t, 4U> thresholds;
+    float scale;
+    double offset;
+    int8_t bias;
+};
+
+// The fields of an IPv4 header that are split from their words
+struct ip_version
+{
+    uint8_t  version;
+    uint8_t  ihl;
+    uint8_t  ttl;
+    uint32_t dest_ip;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<calibration>
+    {
+        using type = std::tuple<uint16_t, std::array<uint32_t, 4U>, float, double, int8_t>;
+    };
+
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<ip_version>
+    {
+        using type = std::tuple<bits<uint8_t, 4U, 4U>, skip<7U>, uint8_t, skip<7U>, uint32_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // Two entries: id 1, thresholds 10 to 40, scale 0.5, offset -2.25, bias -3; then id 2, thresholds 1 to 4, scale 1.5, offset 4, bias 7
+    constexpr uint8_t calibration_blob[] = {
+        0x00, 0x01,
+        0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x28,
+        0x3F, 0x00, 0x00, 0x00,
+        0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xFD,
+        0x00, 0x02,
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04,
+        0x3F, 0xC0, 0x00, 0x00,
+        0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07
+    };
+
+    constexpr auto calibration_table{[] {
+        std::array<calibration, 2U> table{};
+        ldl::network_packet_deserializer deserializer{std::span{calibration_blob}};
+        deserializer.deserialize_into<calibration> (std::span{table});
+        return table;
+    } ()};
+}
+
+// Arithmetic fields, arrays and floating-point values are decoded in constant evaluation
+TEST(ConstexprDecodingTest, LookupTable) {
+
+    constexpr auto first{ldl::deserialize<calibration, std::endian::big> (calibration_blob)};
+    static_assert(first.id == 1U);
+    static_assert(first.thresholds == std::array<uint32_t, 4U>{10U, 20U, 30U, 40U});
+    static_assert(first.scale == 0.5F);
+    static_assert(first.offset == -2.25);
+    static_assert(first.bias == -3);
+
+    static_assert(calibration_table[1].id == 2U);
+    static_assert(calibration_table[1].thresholds[3] == 4U);
+    static_assert(calibration_table[1].scale == 1.5F);
+    static_assert(calibration_table[1].offset == 4.0);
+    static_assert(calibration_table[1].bias == 7);
+
+    // The same bytes decoded at run time
+    ldl::network_packet_deserializer deserializer{std::span{calibration_blob}};
+    deserializer.skip<calibration>();
+    const auto second{deserializer.deserialize<calibration>()};
+    ASSERT_EQ(second.thresholds, calibration_table[1].thresholds);
+    ASSERT_EQ(second.offset, calibration_table[1].offset);
+}
+
+// Types that take the memcpy fast path at run time are decoded field by field in constant evaluation
+TEST(ConstexprDecodingTest, HeaderStack) {
+
+    static_assert(ldl::concepts::memcpy_deserializable<ip_header>);
+
+    constexpr auto headers{[] {
+        ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+        return deserializer.deserialize<eth_header, ip_header>();
+    } ()};
+    static_assert(std::get<0>(headers).ethertype == 0x0800U);
+    static_assert(std::get<0>(headers).src_mac[5] == 0x5EU);
+    static_assert(std::get<1>(headers).dest_ip == 0xC0A80101U);
+
+    constexpr auto version{[] {
+        ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+        deserializer.skip<eth_header>();
+        return deserializer.deserialize<ip_version>();
+    } ()};
+    static_assert(version.version == 4U);
+    static_assert(version.ihl == 5U);
+    static_assert(version.ttl == std::get<1>(headers).ttl);
+    static_assert(version.dest_ip == std::get<1>(headers).dest_ip);
+
+    const auto ip{ldl::deserialize_at<ip_header, std::endian::big> (eth_ip_tcp_packet + 14U)};
+    ASSERT_EQ(ip.identification, std::get<1>(headers).identification);
+    ASSERT_EQ(ip.checksum, std::get<1>(headers).checksum);
+}
+
+// Little-endian blobs held in a std::array
+TEST(ConstexprDecodingTest, LittleEndian) {
+
+    constexpr std::array<uint8_t, 8U> blob{0x01, 0x02, 0x03, 0x04, 0x00, 0x00, 0xC0, 0x3F};
+    static_assert(ldl::deserialize<uint32_t, std::endian::little> (blob) == 0x04030201U);
+    static_assert(ldl::deserialize<std::array<uint16_t, 2U>, std::endian::little> (blob) == std::array<uint16_t, 2U>{0x0201U, 0x0403U});
+    static_assert(ldl::deserialize<uint64_t, std::endian::big> (blob) == 0x010203040000C03FU);
+
+    constexpr auto scale{[&blob] {
+        ldl::object_deserializer<const uint8_t, std::endian::little> deserializer{std::span{blob}};
+        deserializer.skip (4U);
+        return deserializer.deserialize<float>();
+    } ()};
+    static_assert(scale == 1.5F);
+}
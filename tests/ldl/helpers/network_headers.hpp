@@ -63,4 +63,29 @@ struct tcp_header
     uint16_t window_size;       // Window Size
     uint16_t checksum;          // Checksum
     uint16_t urgent_pointer;    // Urgent Pointer (if URG flag is set)
-};
\ No newline at end of file
+};
+
+// IPv6 Header (40 bytes)
+struct ipv6_header
+{
+    uint32_t version_class_flow;        // Version (4 bits) + Traffic Class (8 bits) + Flow Label (20 bits)
+    uint16_t payload_length;            // Length of the payload, extension headers included
+    uint8_t  next_header;               // Type of the next header (e.g., 6 for TCP)
+    uint8_t  hop_limit;                 // Hop Limit
+    std::array<uint8_t, 16U> src_ip;    // Source IP Address
+    std::array<uint8_t, 16U> dest_ip;   // Destination IP Address
+};
+
+// ARP Packet for IPv4 over Ethernet (28 bytes)
+struct arp_header
+{
+    uint16_t hardware_type;             // Hardware Type (1 for Ethernet)
+    uint16_t protocol_type;             // Protocol Type (0x0800 for IPv4)
+    uint8_t  hardware_length;           // Hardware Address Length
+    uint8_t  protocol_length;           // Protocol Address Length
+    uint16_t operation;                 // Operation (1 for request, 2 for reply)
+    std::array<uint8_t, 6U> sender_mac; // Sender Hardware Address
+    uint32_t sender_ip;                 // Sender Protocol Address
+    std::array<uint8_t, 6U> target_mac; // Target Hardware Address
+    uint32_t target_ip;                 // Target Protocol Address
+};
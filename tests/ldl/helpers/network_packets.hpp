@@ -46,4 +46,19 @@ const uint8_t eth_ip_opt_tcp_seg_packet[] = {
 
     // TCP Data (4 bytes: "TEST")
     0x54, 0x45, 0x53, 0x54
-};
\ No newline at end of file
+};
+
+const uint8_t eth_arp_packet[] = {
+    // Ethernet Header (14 bytes)
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // Destination MAC: broadcast
+    0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E, // Source MAC
+    0x08, 0x06,                         // EtherType: ARP (0x0806)
+
+    // ARP Packet (28 bytes)
+    0x00, 0x01, 0x08, 0x00,             // Hardware Type: Ethernet, Protocol Type: IPv4
+    0x06, 0x04, 0x00, 0x01,             // Hardware Length (6), Protocol Length (4), Operation: request
+    0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E, // Sender MAC
+    0xC0, 0xA8, 0x01, 0x64,             // Sender IP: 192.168.1.100
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Target MAC: unknown
+    0xC0, 0xA8, 0x01, 0x01,             // Target IP: 192.168.1.1
+};
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/incremental_parser.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    using packet_parser = ldl::network_packet_parser<eth_header, ip_header, tcp_header>;
+
+    void check_headers (const packet_parser & parser)
+    {
+        ASSERT_TRUE(parser.done());
+        ASSERT_EQ(parser.get<0>().ethertype, 0x0800U);
+        ASSERT_EQ(parser.get<1>().identification, 6699U);
+        ASSERT_EQ(format_ip_address (parser.get<1>().src_ip), "192.168.1.100");
+        ASSERT_EQ(format_ip_address (parser.get<1>().dest_ip), "192.168.1.1");
+        ASSERT_EQ(parser.get<2>().seq_number, 305419896U);
+        ASSERT_EQ(parser.get<2>().ack_number, 2596069104U);
+        ASSERT_EQ(parser.get<2>().window_size, 0x7110U);
+    }
+}
+
+// The whole packet is fed at once
+TEST(IncrementalParsingTest, SinglePiece) {
+
+    packet_parser parser;
+    ASSERT_EQ(parser.missing(), sizeof(eth_ip_tcp_packet));
+    ASSERT_EQ(parser.feed (std::span{eth_ip_tcp_packet}), sizeof(eth_ip_tcp_packet));
+    check_headers (parser);
+    ASSERT_EQ(parser.missing(), 0U);
+}
+
+// The packet is fed one byte at a time
+TEST(IncrementalParsingTest, ByteByByte) {
+
+    packet_parser parser;
+    for (size_t i{0U}; i < sizeof(eth_ip_tcp_packet); ++i) {
+        ASSERT_FALSE(parser.done());
+        ASSERT_EQ(parser.missing(), sizeof(eth_ip_tcp_packet) - i);
+        ASSERT_EQ(parser.feed (std::span{eth_ip_tcp_packet}.subspan (i, 1U)), 1U);
+        ASSERT_EQ(parser.decoded(), (i >= 53U) ? 3U : (i >= 33U) ? 2U : (i >= 13U) ? 1U : 0U);
+    }
+    check_headers (parser);
+}
+
+// Pieces that split headers, an empty piece, and trailing bytes that belong to the payload
+TEST(IncrementalParsingTest, UnevenPieces) {
+
+    std::vector<uint8_t> stream(std::begin (eth_ip_tcp_packet), std::end (eth_ip_tcp_packet));
+    stream.insert (stream.end(), {0xDEU, 0xADU, 0xBEU, 0xEFU});
+
+    packet_parser parser;
+    const auto bytes{std::span{stream}};
+    ASSERT_EQ(parser.feed (bytes.subspan (0U, 10U)), 10U);
+    ASSERT_EQ(parser.decoded(), 0U);
+    ASSERT_EQ(parser.feed (bytes.subspan (10U, 0U)), 0U);
+    ASSERT_EQ(parser.feed (bytes.subspan (10U, 30U)), 30U);
+    ASSERT_EQ(parser.decoded(), 2U);
+    ASSERT_EQ(parser.get<0>().ethertype, 0x0800U);
+    ASSERT_EQ(parser.missing(), 14U);
+    ASSERT_EQ(parser.feed (bytes.subspan (40U)), 14U);
+    check_headers (parser);
+    ASSERT_EQ(parser.feed (bytes.subspan (54U)), 0U);
+
+    parser.reset();
+    ASSERT_EQ(parser.decoded(), 0U);
+    ASSERT_EQ(parser.missing(), sizeof(eth_ip_tcp_packet));
+    ASSERT_EQ(parser.feed (std::as_bytes (bytes)), sizeof(eth_ip_tcp_packet));
+    check_headers (parser);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <string_view>
+
+#include "ldl/object_deserializer.hpp"
+
+
+// A message whose payload is preceded by its 16-bit length
+struct tlv_message
+{
+    uint8_t type;
+    std::span<const uint8_t> payload;
+    uint16_t checksum;
+};
+
+// A record whose name length comes first, separated from the name by an identifier
+struct named_record
+{
+    uint8_t name_length;
+    uint32_t id;
+    std::string_view name;
+};
+
+struct message_pair
+{
+    tlv_message message;
+    named_record record;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tlv_message>
+    {
+        using type = std::tuple<uint8_t, length_prefixed<uint16_t>, uint16_t>;
+    };
+
+    template<> struct rule<named_record>
+    {
+        using type = std::tuple<uint8_t, uint32_t, sized_by<0U>>;
+    };
+
+    template<> struct rule<message_pair>
+    {
+        using type = std::tuple<tlv_message, named_record>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t messages[] = {
+        0x07, 0x00, 0x03, 0xAA, 0xBB, 0xCC, 0x12, 0x34,         // Type, payload length (3), payload, checksum
+        0x04, 0x00, 0x00, 0x01, 0x02, 'e', 't', 'h', '0',       // Name length (4), identifier, name
+        0xFF
+    };
+}
+
+// The minimum length counts the fixed-size elements only
+TEST(LengthPrefixedFieldsTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<tlv_message>() == 5U);
+    static_assert(ldl::deserialization_length<named_record>() == 5U);
+    static_assert(ldl::deserialization_length<message_pair>() == 10U);
+    static_assert(ldl::concepts::fixed_length<ldl::bits<uint8_t, 4U, 4U>>);
+    static_assert(!ldl::concepts::fixed_length<message_pair>);
+
+    ASSERT_EQ((ldl::deserialization_length_at<tlv_message, std::endian::big> (messages, sizeof(messages))), 8U);
+    ASSERT_EQ((ldl::deserialization_length_at<message_pair, std::endian::big> (messages, sizeof(messages))), 17U);
+    ASSERT_EQ((ldl::deserialization_length_at<message_pair, std::endian::big> (messages, 16U)), std::numeric_limits<size_t>::max());
+}
+
+// Variable-size fields are views over the buffer
+TEST(LengthPrefixedFieldsTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{messages}};
+    const auto message = deserializer.deserialize<tlv_message>();
+    ASSERT_EQ(message.type, 0x07U);
+    ASSERT_EQ(message.payload.data(), messages + 3U);
+    ASSERT_EQ(message.payload.size(), 3U);
+    ASSERT_EQ(message.payload[2], 0xCCU);
+    ASSERT_EQ(message.checksum, 0x1234U);
+
+    const auto record = deserializer.deserialize<named_record>();
+    ASSERT_EQ(record.id, 0x00000102U);
+    ASSERT_EQ(record.name, "eth0");
+    ASSERT_EQ(static_cast<const void *> (record.name.data()), static_cast<const void *> (messages + 13U));
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 1U);
+
+    ldl::network_packet_deserializer pair_deserializer{std::span{messages}};
+    const auto pair = pair_deserializer.deserialize<message_pair>();
+    ASSERT_EQ(pair.message.checksum, 0x1234U);
+    ASSERT_EQ(pair.record.name, "eth0");
+    ASSERT_EQ(pair_deserializer.get_unread_buffer().size(), 1U);
+}
+
+// Length fields that exceed the buffer are detected before anything is read past it
+TEST(LengthPrefixedFieldsTest, Exceptions) {
+
+    ldl::network_packet_deserializer deserializer{std::span{messages}.first<7U>()};
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<tlv_message>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 7U);
+
+    ldl::network_packet_deserializer pair_deserializer{std::span{messages}.first<16U>()};
+    ASSERT_FALSE(pair_deserializer.try_deserialize<message_pair>().has_value());
+    ASSERT_EQ(pair_deserializer.get_unread_buffer().size(), 16U);
+
+    const uint8_t oversized[] = {0x07, 0xFF, 0xFF, 0x00, 0x00};
+    ldl::network_packet_deserializer oversized_deserializer{std::span{oversized}};
+    ASSERT_FALSE(oversized_deserializer.try_deserialize<tlv_message>().has_value());
+}
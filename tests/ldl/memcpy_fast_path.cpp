@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// 32 bytes without padding, with multi-byte fields on both sides of the 16-byte boundary
+struct telemetry
+{
+    uint64_t timestamp;
+    uint32_t sequence;
+    uint16_t flags;
+    int16_t  temperature;
+    std::array<uint16_t, 5U> samples;
+    uint16_t crc;
+    float    voltage;
+};
+
+// Larger than a few 16-byte blocks, with a long array converted as one run
+struct waveform
+{
+    uint32_t channel;
+    std::array<int16_t, 71U> samples;
+    uint16_t checksum;
+};
+
+// Padding between channel and value
+struct padded
+{
+    uint8_t  channel;
+    uint32_t value;
+};
+
+// The rule lists narrower types than the members
+struct widened
+{
+    uint32_t value;
+    uint16_t low;
+    uint16_t high;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<telemetry>
+    {
+        using type = std::tuple<uint64_t, uint32_t, uint16_t, int16_t, std::array<uint16_t, 5U>, uint16_t, float>;
+    };
+
+    template<> struct rule<waveform>
+    {
+        using type = std::tuple<uint32_t, std::array<int16_t, 71U>, uint16_t>;
+    };
+
+    template<> struct rule<padded>
+    {
+        using type = std::tuple<uint8_t, uint32_t>;
+    };
+
+    template<> struct rule<widened>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    static_assert(ldl::concepts::memcpy_deserializable<eth_header>);
+    static_assert(ldl::concepts::memcpy_deserializable<ip_header>);
+    static_assert(ldl::concepts::memcpy_deserializable<tcp_header>);
+    static_assert(ldl::concepts::memcpy_deserializable<telemetry>);
+    static_assert(ldl::concepts::memcpy_deserializable<waveform>);
+    static_assert(!ldl::concepts::memcpy_deserializable<padded>);
+    static_assert(!ldl::concepts::memcpy_deserializable<widened>);
+
+    // Field-by-field reference decoding, bypassing the fast path
+    template<typename T, std::endian E> T construct_field_by_field (std::span<const uint8_t> bytes)
+    {
+        return ldl::construct_from_tuple<T, ldl::deserialization_rules::rule_t<T>, E> (bytes);
+    }
+}
+
+// The fast path decodes the same values as the field-by-field path, for both byte orders
+TEST(MemcpyFastPathTest, NetworkHeaders) {
+
+    const auto packet{std::span{eth_ip_tcp_packet}};
+    ldl::network_packet_deserializer deserializer{packet};
+    const auto ether_frame{deserializer.deserialize<eth_header>()};
+    const auto ip_packet{deserializer.deserialize<ip_header>()};
+    const auto tcp_packet{deserializer.deserialize<tcp_header>()};
+    ASSERT_EQ(ether_frame.src_mac, std::to_array<uint8_t> ({0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E}));
+    ASSERT_EQ(ether_frame.ethertype, 0x0800U);
+    ASSERT_EQ(ip_packet.identification, 6699U);
+    ASSERT_EQ(ip_packet.src_ip, 0xC0A80164U);
+    ASSERT_EQ(tcp_packet.seq_number, 305419896U);
+    ASSERT_EQ(tcp_packet.window_size, 0x7110U);
+
+    const auto reference{construct_field_by_field<tcp_header, std::endian::little> (packet.subspan (34U))};
+    const auto little{ldl::object_deserializer<const uint8_t, std::endian::little>{packet.subspan (34U)}.deserialize<tcp_header>()};
+    ASSERT_EQ(little.src_port, reference.src_port);
+    ASSERT_EQ(little.seq_number, reference.seq_number);
+    ASSERT_EQ(little.ack_number, reference.ack_number);
+    ASSERT_EQ(little.window_size, reference.window_size);
+    ASSERT_EQ(little.urgent_pointer, reference.urgent_pointer);
+}
+
+// Fields after the first 16 bytes, arrays, signed and floating point fields
+TEST(MemcpyFastPathTest, WideRecord) {
+
+    const auto bytes{[] {
+        std::array<uint8_t, sizeof(telemetry)> bytes;
+        for (size_t i{0U}; i < bytes.size(); ++i) {
+            bytes[i] = static_cast<uint8_t> ((i * 29U) + 3U);
+        }
+        return bytes;
+    } ()};
+
+    const auto check{[&bytes] <std::endian E> (void) {
+        const auto value{ldl::object_deserializer<const uint8_t, E>{std::span{bytes}}.template deserialize<telemetry>()};
+        const auto reference{construct_field_by_field<telemetry, E> (bytes)};
+        ASSERT_EQ(value.timestamp, reference.timestamp);
+        ASSERT_EQ(value.sequence, reference.sequence);
+        ASSERT_EQ(value.flags, reference.flags);
+        ASSERT_EQ(value.temperature, reference.temperature);
+        ASSERT_EQ(value.samples, reference.samples);
+        ASSERT_EQ(value.crc, reference.crc);
+        ASSERT_EQ(std::bit_cast<uint32_t> (value.voltage), std::bit_cast<uint32_t> (reference.voltage));
+    }};
+    check.template operator()<std::endian::big>();
+    check.template operator()<std::endian::little>();
+}
+
+// Objects too large to be shuffled block by block are converted field by field, and array fields as a whole
+TEST(MemcpyFastPathTest, LargeRecord) {
+
+    const auto bytes{[] {
+        std::array<uint8_t, sizeof(waveform)> bytes;
+        for (size_t i{0U}; i < bytes.size(); ++i) {
+            bytes[i] = static_cast<uint8_t> ((i * 13U) + 7U);
+        }
+        return bytes;
+    } ()};
+
+    const auto check{[&bytes] <std::endian E> (void) {
+        const auto value{ldl::object_deserializer<const uint8_t, E>{std::span{bytes}}.template deserialize<waveform>()};
+        const auto reference{construct_field_by_field<waveform, E> (bytes)};
+        ASSERT_EQ(value.channel, reference.channel);
+        ASSERT_EQ(value.samples, reference.samples);
+        ASSERT_EQ(value.checksum, reference.checksum);
+    }};
+    check.template operator()<std::endian::big>();
+    check.template operator()<std::endian::little>();
+}
+
+// Types that do not qualify are still decoded field by field
+TEST(MemcpyFastPathTest, Fallback) {
+
+    const uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+
+    ldl::network_packet_deserializer deserializer{std::span{bytes}};
+    const auto padded_value{deserializer.deserialize<padded>()};
+    ASSERT_EQ(padded_value.channel, 0x01U);
+    ASSERT_EQ(padded_value.value, 0x02030405U);
+
+    ldl::network_packet_deserializer widened_deserializer{std::span{bytes}};
+    const auto widened_value{widened_deserializer.deserialize<widened>()};
+    ASSERT_EQ(widened_value.value, 0x0102U);
+    ASSERT_EQ(widened_value.low, 0x0304U);
+    ASSERT_EQ(widened_value.high, 0x0506U);
+}
+
+// Records are constructed in place only in ranges of the record type; other contiguous outputs are assigned
+TEST(MemcpyFastPathTest, ContiguousOutputOfAnotherType) {
+
+    const auto bytes{[] {
+        std::array<uint8_t, 2U * sizeof(telemetry)> bytes;
+        for (size_t i{0U}; i < bytes.size(); ++i) {
+            bytes[i] = static_cast<uint8_t> ((i * 29U) + 3U);
+        }
+        return bytes;
+    } ()};
+    const auto first{construct_field_by_field<telemetry, std::endian::big> (std::span{bytes}.first<sizeof(telemetry)>())};
+    const auto second{construct_field_by_field<telemetry, std::endian::big> (std::span{bytes}.last<sizeof(telemetry)>())};
+
+    ldl::network_packet_deserializer optional_deserializer{std::span{bytes}};
+    std::vector<std::optional<telemetry>> optionals(3U);
+    optional_deserializer.deserialize_n<telemetry> (2U, optionals.begin());
+    ASSERT_TRUE(optionals[0U].has_value());
+    ASSERT_TRUE(optionals[1U].has_value());
+    ASSERT_FALSE(optionals[2U].has_value());
+    ASSERT_EQ(optionals[0U]->timestamp, first.timestamp);
+    ASSERT_EQ(optionals[1U]->samples, second.samples);
+    ASSERT_EQ(optionals[1U]->crc, second.crc);
+
+    ldl::network_packet_deserializer in_place_deserializer{std::span{bytes}};
+    std::vector<telemetry> records(2U);
+    in_place_deserializer.deserialize_into<telemetry> (std::span{records});
+    ASSERT_EQ(records[0U].timestamp, first.timestamp);
+    ASSERT_EQ(records[1U].samples, second.samples);
+    ASSERT_EQ(records[1U].crc, second.crc);
+}
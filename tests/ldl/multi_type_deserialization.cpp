@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+// A header stack is deserialized at once, as with one call per header
+TEST(MultiTypeDeserializationTest, HeaderStack) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    const auto [ether_frame, ip_packet, tcp_packet] = deserializer.deserialize<eth_header, ip_header, tcp_header>();
+    ASSERT_EQ(ether_frame.src_mac, std::to_array<uint8_t> ({0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E}));
+    ASSERT_EQ(ether_frame.ethertype, 0x0800U);
+    ASSERT_EQ(ip_packet.identification, 6699U);
+    ASSERT_EQ(ip_packet.dest_ip, 0xC0A80101U);
+    ASSERT_EQ(tcp_packet.seq_number, 305419896U);
+    ASSERT_EQ(tcp_packet.window_size, 0x7110U);
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+
+    ldl::network_packet_deserializer ip_deserializer{std::span{eth_ip_tcp_packet}.subspan<14U>()};
+    const auto [version, type_of_service, total_length] = ip_deserializer.deserialize_noexcept<uint8_t, uint8_t, uint16_t>();
+    ASSERT_EQ(version, 0x45U);
+    ASSERT_EQ(type_of_service, 0x00U);
+    ASSERT_EQ(total_length, 52U);
+    ASSERT_EQ(ip_deserializer.get_unread_buffer().size(), 36U);
+}
+
+// The summed length is checked before anything is read
+TEST(MultiTypeDeserializationTest, TruncatedStack) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}.first<53U>()};
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<eth_header, ip_header, tcp_header>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 53U);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+#include "ldl/object_deserializer.hpp"
+
+
+// A frame of eight 12-bit samples, between a channel number and a checksum
+struct sensor_frame
+{
+    uint8_t                  channel;
+    std::array<uint16_t, 8U> samples;
+    uint16_t                 checksum;
+};
+
+// Four 10-bit readings, as packed by a little endian device
+struct adc_readings
+{
+    std::array<uint16_t, 4U> readings;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<sensor_frame>
+    {
+        using type = std::tuple<uint8_t, packed_array<12U, 8U>, uint16_t>;
+    };
+
+    template<> struct rule<adc_readings>
+    {
+        using type = std::tuple<packed_array<10U, 4U>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t frame[] = {
+        0x07,                                   // Channel
+        0x00, 0x10, 0x02, 0x80, 0x0F, 0xFF,     // Samples: 0x001, 0x002, 0x800, 0xFFF
+        0x12, 0x34, 0x56, 0xAB, 0xCD, 0xEF,     // Samples: 0x123, 0x456, 0xABC, 0xDEF
+        0xBE, 0xEF,                             // Checksum
+        0xFF
+    };
+
+    // Packs values bit by bit, from the most significant bit of every byte down for big endian, from the least significant bit up otherwise
+    std::vector<uint8_t> pack (const std::vector<uint32_t> & values, size_t bits, std::endian endianness)
+    {
+        std::vector<uint8_t> bytes(((values.size() * bits) + 7U) / 8U);
+        for (size_t i{0U}; i < values.size(); ++i) {
+            for (size_t b{0U}; b < bits; ++b) {
+                const auto position{(i * bits) + b};
+                const auto bit{(endianness == std::endian::big) ? ((values[i] >> (bits - 1U - b)) & 1U) : ((values[i] >> b) & 1U)};
+                const auto shift{(endianness == std::endian::big) ? (7U - (position % 8U)) : (position % 8U)};
+                bytes[position / 8U] = static_cast<uint8_t> (bytes[position / 8U] | (bit << shift));
+            }
+        }
+        return bytes;
+    }
+
+    template<size_t Bits, std::endian E, typename T> void check_unpacking (size_t count)
+    {
+        std::mt19937_64 generator{Bits * count};
+        std::vector<uint32_t> values(count);
+        for (auto & value : values) {
+            value = static_cast<uint32_t> (generator() & ((uint64_t{1U} << Bits) - 1U));
+        }
+        const auto bytes{pack (values, Bits, E)};
+
+        std::vector<T> unpacked(count);
+        ldl::object_deserializer<const uint8_t, E> deserializer{std::span{bytes}};
+        deserializer.template unpack_into<Bits> (std::span{unpacked});
+        ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+        for (size_t i{0U}; i < count; ++i) {
+            ASSERT_EQ(unpacked[i], values[i]) << Bits << " bits, value " << i;
+        }
+    }
+
+    template<std::endian E> void check_widths (void)
+    {
+        [] <size_t... Widths> (std::index_sequence<Widths...>) {
+            (check_unpacking<Widths + 1U, E, uint32_t> (67U), ...);
+        } (std::make_index_sequence<32U>());
+
+        check_unpacking<5U, E, uint8_t> (100U);
+        check_unpacking<10U, E, uint16_t> (1000U);
+        check_unpacking<12U, E, uint16_t> (1001U);
+        check_unpacking<20U, E, uint64_t> (999U);
+        check_unpacking<25U, E, uint32_t> (64U);
+    }
+}
+
+TEST(PackedArraysTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<ldl::packed_array<12U, 8U>>() == 12U);
+    static_assert(ldl::deserialization_length<ldl::packed_array<10U, 5U>>() == 7U);
+    static_assert(ldl::deserialization_length<sensor_frame>() == 15U);
+    static_assert(std::is_same_v<ldl::packed_array<20U, 4U>::value_type, uint32_t>);
+    static_assert(ldl::concepts::fixed_length<sensor_frame>);
+}
+
+TEST(PackedArraysTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{frame}};
+    const auto decoded = deserializer.deserialize<sensor_frame>();
+    ASSERT_EQ(decoded.channel, 7U);
+    ASSERT_EQ(decoded.samples, (std::array<uint16_t, 8U>{0x001U, 0x002U, 0x800U, 0xFFFU, 0x123U, 0x456U, 0xABCU, 0xDEFU}));
+    ASSERT_EQ(decoded.checksum, 0xBEEFU);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 1U);
+
+    // Little endian packs every value from the least significant bit of its first byte up
+    const uint8_t readings[] = {0x01, 0x08, 0x30, 0x00, 0xFF};
+    ldl::object_deserializer<const uint8_t, std::endian::little> little_deserializer{std::span{readings}};
+    ASSERT_EQ(little_deserializer.deserialize<adc_readings>().readings, (std::array<uint16_t, 4U>{1U, 2U, 3U, 0x3FCU}));
+}
+
+TEST(PackedArraysTest, ConstantEvaluation) {
+
+    constexpr auto samples{ldl::deserialize<ldl::packed_array<12U, 2U>, std::endian::big> (std::array<uint8_t, 3U>{0xAB, 0xCD, 0xEF})};
+    static_assert(samples.values[0] == 0xABCU);
+    static_assert(samples.values[1] == 0xDEFU);
+}
+
+// Every width, with counts that leave values past the last group of eight, and output types of every size
+TEST(PackedArraysTest, Unpacking) {
+
+    check_widths<std::endian::big>();
+    check_widths<std::endian::little>();
+}
+
+TEST(PackedArraysTest, Exceptions) {
+
+    ldl::network_packet_deserializer truncated{std::span{frame}.first (14U)};
+    ASSERT_THROW(truncated.deserialize<sensor_frame>(), std::length_error);
+
+    // Nine 12-bit values take 14 bytes
+    std::array<uint16_t, 9U> samples;
+    ldl::network_packet_deserializer deserializer{std::span{frame}.subspan (1U, 13U)};
+    ASSERT_THROW(deserializer.unpack_into<12U> (std::span<uint16_t>{samples}), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 13U);
+    // 2^60 16-bit values would take 2^64 bytes, which wraps to 0; only the size of the span is looked at before the throw
+    ASSERT_THROW(deserializer.unpack_into<16U> (std::span<uint16_t>{samples.data(), size_t{1U} << 60U}), std::length_error);
+    deserializer.unpack_into<12U> (std::span<uint16_t>{samples}.first (8U));
+    ASSERT_EQ(samples[7], 0xDEFU);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 1U);
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+
+#include "ldl/parallel_deserializer.hpp"
+
+
+// A message whose payload is preceded by its 16-bit length
+struct tlv_message
+{
+    uint8_t type;
+    std::span<const uint8_t> payload;
+    uint16_t checksum;
+};
+
+// A port number whose constructor rejects port 0
+class port
+{
+public:
+    port (void) = default;
+    explicit port (uint16_t number) : number_{number}
+    {
+        if (number == 0U) {
+            throw std::invalid_argument{"port 0 is reserved"};
+        }
+    }
+
+    uint16_t number (void) const noexcept { return number_; }
+
+private:
+    uint16_t number_{0U};
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<port>
+    {
+        using type = std::tuple<uint16_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<tlv_message>
+    {
+        using type = std::tuple<uint8_t, length_prefixed<uint16_t>, uint16_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // TCP headers whose sequence numbers are their indices
+    std::vector<uint8_t> make_headers (size_t count)
+    {
+        std::vector<uint8_t> bytes(count * ldl::deserialization_length<tcp_header>());
+        for (size_t i{0U}; i < count; ++i) {
+            const auto header{bytes.begin() + static_cast<std::ptrdiff_t> (i * ldl::deserialization_length<tcp_header>())};
+            header[4] = static_cast<uint8_t> (i >> 24U);
+            header[5] = static_cast<uint8_t> (i >> 16U);
+            header[6] = static_cast<uint8_t> (i >> 8U);
+            header[7] = static_cast<uint8_t> (i);
+        }
+
+        return bytes;
+    }
+
+    // Messages whose type is their index modulo 256, and whose payload is as long as the type
+    std::vector<uint8_t> make_messages (size_t count)
+    {
+        std::vector<uint8_t> bytes;
+        for (size_t i{0U}; i < count; ++i) {
+            const auto type{static_cast<uint8_t> (i)};
+            bytes.insert (bytes.end(), {type, 0x00U, type});
+            bytes.insert (bytes.end(), type, type);
+            bytes.insert (bytes.end(), {0x12U, 0x34U});
+        }
+
+        return bytes;
+    }
+}
+
+// Every thread count gives the same records, in order, including a last chunk that is not full
+TEST(ParallelDeserializationTest, FixedLengthRecords) {
+
+    constexpr size_t count{10'007U};
+    const auto bytes{make_headers (count)};
+
+    for (const size_t threads : {1U, 2U, 3U, 8U}) {
+        std::vector<tcp_header> headers(count);
+        ASSERT_EQ((ldl::parallel_deserialize<tcp_header, std::endian::big> (std::span{bytes}, std::span{headers}, threads)), count);
+        for (size_t i{0U}; i < count; ++i) {
+            ASSERT_EQ(headers[i].seq_number, i);
+        }
+    }
+}
+
+TEST(ParallelDeserializationTest, Exceptions) {
+
+    const auto bytes{make_headers (10U)};
+    std::vector<tcp_header> headers(11U);
+    ASSERT_THROW((ldl::parallel_deserialize<tcp_header, std::endian::big> (std::span{bytes}, std::span{headers}, 2U)), std::length_error);
+    ASSERT_EQ((ldl::parallel_deserialize<tcp_header, std::endian::big> (std::span{bytes}, std::span{headers}.first (0U), 2U)), 0U);
+}
+
+// An exception thrown on a worker thread is rethrown on the calling one, instead of terminating the program
+TEST(ParallelDeserializationTest, ExceptionsOnWorkers) {
+
+    // Every chunk holds a port 0, so that the workers throw as well as the calling thread
+    constexpr size_t count{100'000U};
+    std::vector<uint8_t> bytes(2U * count, 0x01U);
+    for (size_t i{0U}; i < bytes.size(); i += 1024U) {
+        bytes[i] = 0x00U;
+        bytes[i + 1U] = 0x00U;
+    }
+
+    std::vector<port> ports(count);
+    for (const size_t threads : {1U, 4U}) {
+        ASSERT_THROW((ldl::parallel_deserialize<port, std::endian::big> (std::span{bytes}, std::span{ports}, threads)), std::invalid_argument);
+    }
+
+    ASSERT_EQ((ldl::parallel_deserialize<port, std::endian::big> (std::span{bytes}.subspan (2U), std::span{ports}.first (511U), 4U)), 511U);
+    ASSERT_EQ(ports.front().number(), 0x0101U);
+}
+
+// The framing pass reads the length fields, and stops at the truncated last message
+TEST(ParallelDeserializationTest, LengthPrefixedRecords) {
+
+    constexpr size_t count{3'000U};
+    auto bytes{make_messages (count)};
+    bytes.pop_back();
+
+    std::vector<tlv_message> messages(count);
+    ASSERT_EQ((ldl::parallel_deserialize<tlv_message, std::endian::big> (std::span<const uint8_t>{bytes}, std::span{messages}, 4U)), count - 1U);
+    for (size_t i{0U}; i < (count - 1U); ++i) {
+        ASSERT_EQ(messages[i].type, static_cast<uint8_t> (i));
+        ASSERT_EQ(messages[i].payload.size(), static_cast<uint8_t> (i));
+        ASSERT_EQ(messages[i].checksum, 0x1234U);
+    }
+
+    // No more records than out can hold
+    ASSERT_EQ((ldl::parallel_deserialize<tlv_message, std::endian::big> (std::span<const uint8_t>{bytes}, std::span{messages}.first (10U), 4U)), 10U);
+}
+
+// A user-defined framing pass, for records that are padded to 4 bytes
+TEST(ParallelDeserializationTest, CustomFraming) {
+
+    const uint8_t padded[] = {
+        0x01, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x00, 0x00,         // Type, payload length (1), payload, checksum, padding
+        0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00          // Type, payload length (0), checksum, padding
+    };
+    const auto frame{[] (std::span<const uint8_t> unread) -> size_t {
+        if (unread.size() < 3U) {
+            return 0U;
+        }
+        const size_t length{5U + ((size_t{unread[1]} << 8U) | unread[2])};
+        return (length + 3U) & ~size_t{3U};
+    }};
+
+    std::vector<tlv_message> messages(4U);
+    ASSERT_EQ((ldl::parallel_deserialize<tlv_message, std::endian::big> (std::span{padded}, std::span{messages}, frame, 2U)), 2U);
+    ASSERT_EQ(messages[0].payload.size(), 1U);
+    ASSERT_EQ(messages[0].checksum, 1U);
+    ASSERT_EQ(messages[1].type, 2U);
+    ASSERT_EQ(messages[1].checksum, 2U);
+}
+
+// A framing pass that returns an int, whose negative values are greater than the unread bytes once converted
+TEST(ParallelDeserializationTest, IntFraming) {
+
+    const uint8_t padded[] = {
+        0x01, 0x00, 0x01, 0xAA, 0x00, 0x01, 0x00, 0x00,         // Type, payload length (1), payload, checksum, padding
+        0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00          // Type, payload length (0), checksum, padding
+    };
+    const auto frame{[] (std::span<const uint8_t> unread) -> int {
+        if (unread.size() < 3U) {
+            return -1;
+        }
+        return (5 + ((unread[1] << 8) | unread[2]) + 3) & ~3;
+    }};
+
+    std::vector<tlv_message> messages(4U);
+    ASSERT_EQ((ldl::parallel_deserialize<tlv_message, std::endian::big> (std::span{padded}, std::span{messages}, frame, 2U)), 2U);
+    ASSERT_EQ(messages[0].payload.size(), 1U);
+    ASSERT_EQ(messages[1].type, 2U);
+    ASSERT_EQ(messages[1].checksum, 2U);
+}
+
+// The framing pass stops at a frame shorter than the record that starts there, instead of letting it be read past its end
+TEST(ParallelDeserializationTest, ShortFrames) {
+
+    const uint8_t messages_bytes[] = {
+        0x01, 0x00, 0x01, 0xAA, 0x00, 0x01,                     // Type, payload length (1), payload, checksum
+        0x02, 0x00, 0x02, 0xBB, 0xCC, 0x00, 0x02,               // Type, payload length (2), payload, checksum
+        0x03, 0x00, 0x00, 0x00, 0x03                            // Type, payload length (0), checksum
+    };
+    // The length of every frame misses the checksum of the second message
+    const auto frame{[] (std::span<const uint8_t> unread) -> size_t {
+        return (unread.size() < 3U) ? 0U : (5U + unread[2] - ((unread[0] == 0x02U) ? 2U : 0U));
+    }};
+
+    std::vector<tlv_message> messages(4U);
+    ASSERT_EQ((ldl::parallel_deserialize<tlv_message, std::endian::big> (std::span{messages_bytes}, std::span{messages}, frame, 2U)), 1U);
+    ASSERT_EQ(messages[0].type, 1U);
+    ASSERT_EQ(messages[0].checksum, 1U);
+
+    // A fixed-length record is checked against its frame as well
+    const auto bytes{make_headers (4U)};
+    std::vector<tcp_header> headers(4U);
+    const auto short_frame{[] (std::span<const uint8_t> unread) { return std::min<size_t> (unread.size(), 19U); }};
+    ASSERT_EQ((ldl::parallel_deserialize<tcp_header, std::endian::big> (std::span{bytes}, std::span{headers}, short_frame, 2U)), 0U);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "helpers/network_packets.hpp"
+
+#include "ldl/mapped_file_source.hpp"
+#include "ldl/pcap_reader.hpp"
+
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // Appends an integer in the given byte order
+    template<typename T> void append (std::vector<uint8_t> & file, T value, std::endian endianness)
+    {
+        for (size_t i{0U}; i < sizeof(T); ++i) {
+            const auto shift{(endianness == std::endian::big) ? (8U * (sizeof(T) - 1U - i)) : (8U * i)};
+            file.push_back (static_cast<uint8_t> (static_cast<uint64_t> (value) >> shift));
+        }
+    }
+
+    void append_record (std::vector<uint8_t> & file, std::span<const uint8_t> data, uint32_t ts_sec, std::endian endianness)
+    {
+        append<uint32_t> (file, ts_sec, endianness);
+        append<uint32_t> (file, 500U, endianness);
+        append<uint32_t> (file, static_cast<uint32_t> (data.size()), endianness);
+        append<uint32_t> (file, static_cast<uint32_t> (data.size() + 10U), endianness);
+        file.insert (file.end(), data.begin(), data.end());
+    }
+
+    std::vector<uint8_t> make_pcap (uint32_t magic, std::endian endianness)
+    {
+        std::vector<uint8_t> file;
+        append<uint32_t> (file, magic, endianness);
+        append<uint16_t> (file, 2U, endianness);
+        append<uint16_t> (file, 4U, endianness);
+        append<int32_t> (file, 0, endianness);
+        append<uint32_t> (file, 0U, endianness);
+        append<uint32_t> (file, 65535U, endianness);
+        append<uint32_t> (file, 1U, endianness);
+        append_record (file, std::span{eth_ip_tcp_packet}, 1700000000U, endianness);
+        append_record (file, std::span{eth_ip_tcp_packet}.first (14U), 1700000001U, endianness);
+
+        return file;
+    }
+
+    void append_block (std::vector<uint8_t> & file, uint32_t type, std::span<const uint8_t> body, std::endian endianness)
+    {
+        const auto padding{(4U - (body.size() % 4U)) % 4U};
+        const auto total_length{static_cast<uint32_t> (12U + body.size() + padding)};
+        append<uint32_t> (file, type, endianness);
+        append<uint32_t> (file, total_length, endianness);
+        file.insert (file.end(), body.begin(), body.end());
+        file.insert (file.end(), padding, 0U);
+        append<uint32_t> (file, total_length, endianness);
+    }
+
+    void append_section (std::vector<uint8_t> & file, std::endian endianness)
+    {
+        std::vector<uint8_t> body;
+        append<uint32_t> (body, 0x1A2B3C4DU, endianness);
+        append<uint16_t> (body, 1U, endianness);
+        append<uint16_t> (body, 0U, endianness);
+        append<uint64_t> (body, ~uint64_t{0U}, endianness);
+        append_block (file, 0x0A0D0D0AU, body, endianness);
+
+        // Interface Description Block, skipped by the reader
+        body.clear();
+        append<uint16_t> (body, 1U, endianness);
+        append<uint16_t> (body, 0U, endianness);
+        append<uint32_t> (body, 65535U, endianness);
+        append_block (file, 1U, body, endianness);
+    }
+
+    void append_enhanced_packet (std::vector<uint8_t> & file, std::span<const uint8_t> data, uint64_t timestamp, std::endian endianness)
+    {
+        std::vector<uint8_t> body;
+        append<uint32_t> (body, 0U, endianness);
+        append<uint32_t> (body, static_cast<uint32_t> (timestamp >> 32U), endianness);
+        append<uint32_t> (body, static_cast<uint32_t> (timestamp), endianness);
+        append<uint32_t> (body, static_cast<uint32_t> (data.size()), endianness);
+        append<uint32_t> (body, static_cast<uint32_t> (data.size()), endianness);
+        body.insert (body.end(), data.begin(), data.end());
+        append_block (file, 6U, body, endianness);
+    }
+}
+
+TEST(PcapReadingTest, LittleEndianFile) {
+
+    const auto file{make_pcap (0xA1B2C3D4U, std::endian::little)};
+    const ldl::pcap::reader reader{std::span{file}};
+    ASSERT_EQ(reader.endianness(), std::endian::little);
+    ASSERT_FALSE(reader.nanosecond_resolution());
+    ASSERT_EQ(reader.header().version_major, 2U);
+    ASSERT_EQ(reader.header().snaplen, 65535U);
+    ASSERT_EQ(reader.header().network, 1U);
+
+    auto record{reader.begin()};
+    ASSERT_FALSE(record == reader.end());
+    ASSERT_EQ(record->header.ts_sec, 1700000000U);
+    ASSERT_EQ(record->header.ts_fraction, 500U);
+    ASSERT_EQ(record->header.original_length, sizeof(eth_ip_tcp_packet) + 10U);
+    ASSERT_EQ(record->data.size(), sizeof(eth_ip_tcp_packet));
+    ASSERT_EQ(record->data.data(), file.data() + 40U);
+    ASSERT_TRUE(std::ranges::equal (record->data, eth_ip_tcp_packet));
+    ++record;
+    ASSERT_EQ(record->header.ts_sec, 1700000001U);
+    ASSERT_EQ(record->data.size(), 14U);
+    ++record;
+    ASSERT_TRUE(record == reader.end());
+}
+
+TEST(PcapReadingTest, BigEndianFile) {
+
+    const auto file{make_pcap (0xA1B23C4DU, std::endian::big)};
+    const ldl::pcap::reader reader{std::span{file}};
+    ASSERT_EQ(reader.endianness(), std::endian::big);
+    ASSERT_TRUE(reader.nanosecond_resolution());
+    ASSERT_EQ(reader.header().network, 1U);
+
+    std::vector<uint32_t> timestamps;
+    for (const auto & record : reader) {
+        timestamps.push_back (record.header.ts_sec);
+    }
+    ASSERT_EQ(timestamps, (std::vector<uint32_t>{1700000000U, 1700000001U}));
+}
+
+// A truncated last record ends the iteration; an unknown magic number or a short file are rejected
+TEST(PcapReadingTest, MalformedFiles) {
+
+    auto file{make_pcap (0xA1B2C3D4U, std::endian::little)};
+    file.resize (file.size() - 1U);
+    const ldl::pcap::reader reader{std::span{file}};
+    ASSERT_EQ(std::ranges::distance (reader.begin(), reader.end()), 1);
+
+    file[0] = 0x00U;
+    ASSERT_THROW(ldl::pcap::reader{std::span{file}}, std::invalid_argument);
+    ASSERT_THROW(ldl::pcap::reader{std::span{file}.first (20U)}, std::length_error);
+}
+
+// Two sections of opposite endianness, with blocks that hold no packet in between
+TEST(PcapReadingTest, PcapngFile) {
+
+    std::vector<uint8_t> file;
+    append_section (file, std::endian::little);
+    append_enhanced_packet (file, std::span{eth_ip_tcp_packet}, 0x0000000100000002U, std::endian::little);
+    append_section (file, std::endian::big);
+    append_enhanced_packet (file, std::span{eth_ip_tcp_packet}.first (15U), 7U, std::endian::big);
+    std::vector<uint8_t> simple;
+    append<uint32_t> (simple, 14U, std::endian::big);
+    simple.insert (simple.end(), std::begin (eth_ip_tcp_packet), std::begin (eth_ip_tcp_packet) + 14);
+    append_block (file, 3U, simple, std::endian::big);
+
+    const ldl::pcap::ng_reader reader{std::span{file}};
+    std::vector<ldl::pcap::packet> packets;
+    std::ranges::copy (reader, std::back_inserter (packets));
+    ASSERT_EQ(packets.size(), 3U);
+    ASSERT_EQ(packets[0].timestamp, 0x0000000100000002U);
+    ASSERT_TRUE(std::ranges::equal (packets[0].data, eth_ip_tcp_packet));
+    ASSERT_EQ(packets[1].timestamp, 7U);
+    ASSERT_EQ(packets[1].data.size(), 15U);
+    ASSERT_EQ(packets[1].original_length, 15U);
+    ASSERT_EQ(packets[2].original_length, 14U);
+    ASSERT_TRUE(std::ranges::equal (packets[2].data, std::span{eth_ip_tcp_packet}.first (14U)));
+
+    ASSERT_THROW(ldl::pcap::ng_reader{std::span{file}.subspan (4U)}, std::invalid_argument);
+}
+
+TEST(PcapReadingTest, MappedFile) {
+
+    const auto path{std::filesystem::temp_directory_path() / "ldl_pcap_reading_test.pcap"};
+    const auto contents{make_pcap (0xA1B2C3D4U, std::endian::little)};
+    std::ofstream{path, std::ios::binary}.write (reinterpret_cast<const char *> (contents.data()), static_cast<std::streamsize> (contents.size()));
+
+    {
+        const ldl::mapped_file_source file{path};
+        ASSERT_EQ(file.size(), contents.size());
+        ASSERT_TRUE(std::ranges::equal (file.bytes(), contents));
+        const ldl::pcap::reader reader{file.bytes()};
+        ASSERT_EQ(std::ranges::distance (reader.begin(), reader.end()), 2);
+    }
+    std::filesystem::remove (path);
+
+    ASSERT_THROW(ldl::mapped_file_source{path}, std::system_error);
+}
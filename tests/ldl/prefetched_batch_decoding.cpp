@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/prefetching_deserializer.hpp"
+
+
+struct eth_ip_tcp_headers
+{
+    eth_header eth;
+    ip_header ip;
+    tcp_header tcp;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<eth_ip_tcp_headers>
+    {
+        using type = std::tuple<eth_header, ip_header, tcp_header>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // Copies of the packet in separate buffers, whose IP identification is their index
+    std::vector<std::vector<uint8_t>> make_packets (size_t count)
+    {
+        std::vector<std::vector<uint8_t>> packets;
+        for (size_t i{0U}; i < count; ++i) {
+            auto & packet{packets.emplace_back (std::begin (eth_ip_tcp_packet), std::end (eth_ip_tcp_packet))};
+            packet[18] = static_cast<uint8_t> (i >> 8U);
+            packet[19] = static_cast<uint8_t> (i);
+        }
+
+        return packets;
+    }
+}
+
+// Prefetch distances shorter than, equal to, and longer than the batch give the same objects
+TEST(PrefetchedBatchDecodingTest, HeaderStack) {
+
+    constexpr size_t count{20U};
+    const auto buffers{make_packets (count)};
+    const std::vector<std::span<const uint8_t>> packets(buffers.begin(), buffers.end());
+
+    for (const size_t distance : {0U, 1U, 8U, 20U, 64U}) {
+        std::vector<eth_ip_tcp_headers> headers(count);
+        ldl::deserialize_batch<eth_ip_tcp_headers, std::endian::big> (std::span{packets}, std::span{headers}, distance);
+        for (size_t i{0U}; i < count; ++i) {
+            ASSERT_EQ(headers[i].eth.ethertype, 0x0800U);
+            ASSERT_EQ(headers[i].ip.identification, i);
+            ASSERT_EQ(format_ip_address (headers[i].ip.dest_ip), "192.168.1.1");
+            ASSERT_EQ(headers[i].tcp.window_size, 0x7110U);
+        }
+    }
+}
+
+TEST(PrefetchedBatchDecodingTest, Exceptions) {
+
+    auto buffers{make_packets (3U)};
+    buffers[1].resize (53U);
+    const std::vector<std::span<const uint8_t>> packets(buffers.begin(), buffers.end());
+
+    std::vector<eth_ip_tcp_headers> headers(3U);
+    ASSERT_THROW((ldl::deserialize_batch<eth_ip_tcp_headers, std::endian::big> (std::span{packets}, std::span{headers})), std::length_error);
+    ASSERT_THROW((ldl::deserialize_batch<ip_header, std::endian::big> (std::span{packets}, std::span<ip_header>{})), std::length_error);
+
+    // The IP headers alone are not truncated
+    const std::vector<std::span<const uint8_t>> ip_packets{packets[0].subspan (14U), packets[1].subspan (14U), packets[2].subspan (14U)};
+    std::vector<ip_header> ip_headers(3U);
+    ldl::deserialize_batch<ip_header, std::endian::big> (std::span{ip_packets}, std::span{ip_headers});
+    ASSERT_EQ(ip_headers[2].identification, 0x0002U);
+}
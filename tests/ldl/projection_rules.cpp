@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// The 5-tuple of a TCP/IPv4 flow, projected from an IPv4 header followed by a TCP header
+struct flow_key
+{
+    uint8_t  protocol;
+    uint32_t src_ip;
+    uint32_t dest_ip;
+    uint16_t src_port;
+    uint16_t dest_port;
+};
+
+// The TTL and the source address of an IPv4 header
+struct ip_source
+{
+    uint8_t  ttl;
+    uint32_t src_ip;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<flow_key>
+    {
+        using type = std::tuple<skip<9U>, uint8_t, skip<2U>, uint32_t, uint32_t, uint16_t, uint16_t, ignore<uint32_t>, ignore<uint32_t>, skip<8U>>;
+    };
+
+    template<> struct rule<ip_source>
+    {
+        using type = std::tuple<ignore<std::array<uint16_t, 4U>>, uint8_t, skip<3U>, uint32_t, ignore<uint32_t>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+// Skipped elements count toward the deserialization length
+TEST(ProjectionRulesTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<ldl::skip<9U>>() == 9U);
+    static_assert(ldl::deserialization_length<ldl::ignore<std::array<uint16_t, 4U>>>() == 8U);
+    static_assert(ldl::deserialization_length<flow_key>() == 40U);
+    static_assert(ldl::deserialization_length<ip_source>() == 20U);
+    static_assert(!ldl::concepts::memcpy_deserializable<ip_source>);
+}
+
+// Only the projected fields are read, and the buffer is advanced past the skipped ones
+TEST(ProjectionRulesTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    deserializer.skip (14U);
+    const auto key = deserializer.deserialize<flow_key>();
+    ASSERT_EQ(key.protocol, 0x06U);
+    ASSERT_EQ(format_ip_address (key.src_ip), "192.168.1.100");
+    ASSERT_EQ(format_ip_address (key.dest_ip), "192.168.1.1");
+    ASSERT_EQ(key.src_port, 12345U);
+    ASSERT_EQ(key.dest_port, 80U);
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+
+    ldl::network_packet_deserializer ip_deserializer{std::span{eth_ip_tcp_packet}.subspan<14U>()};
+    const auto source = ip_deserializer.deserialize<ip_source>();
+    ASSERT_EQ(source.ttl, 64U);
+    ASSERT_EQ(format_ip_address (source.src_ip), "192.168.1.100");
+    ASSERT_EQ(ip_deserializer.get_unread_buffer().size(), 20U);
+
+    const auto key_view = ldl::network_packet_deserializer{std::span{eth_ip_tcp_packet}.subspan<14U>()}.view<flow_key>();
+    ASSERT_EQ(key_view.get<5>(), 12345U);
+}
+
+// Skipped bytes must still be available in the buffer
+TEST(ProjectionRulesTest, Exceptions) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}.subspan<14U>().first<39U>()};
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<flow_key>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+}
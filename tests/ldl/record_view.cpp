@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<mac>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+    };
+
+    template<> struct rule<eth_header_composed>
+    {
+        using type = std::tuple<mac, mac, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+// Fields are decoded on access, and the view holds a single pointer
+TEST(RecordViewTest, FieldAccess) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    deserializer.skip<eth_header_composed>();
+    const auto ip_view = deserializer.view<ip_header>();
+    static_assert(sizeof(ip_view) == sizeof(const uint8_t *));
+    static_assert(decltype(ip_view)::size() == 10U);
+    ASSERT_EQ(ip_view.data(), eth_ip_tcp_packet + 14U);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 20U);
+
+    ASSERT_EQ(ip_view.get<6>(), 0x06U);
+    ASSERT_EQ(format_ip_address (ip_view.get<8>()), "192.168.1.100");
+    ASSERT_EQ(format_ip_address (ip_view.get<9>()), "192.168.1.1");
+    ASSERT_EQ(ip_view.get<3>(), 6699U);
+
+    const auto ip_packet = ip_view.decode();
+    ASSERT_EQ(ip_packet.identification, ip_view.get<3>());
+    ASSERT_EQ(ip_packet.dest_ip, ip_view.get<9>());
+}
+
+// Nested rules are viewed through nested views
+TEST(RecordViewTest, NestedRules) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    const auto eth_view = deserializer.view<eth_header_composed>();
+    ASSERT_EQ(eth_view.get<2>(), 0x0800U);
+    ASSERT_EQ(eth_view.get<1>(), (mac{0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E}));
+
+    const auto src_mac_view = eth_view.view<1>();
+    ASSERT_EQ(src_mac_view.data(), eth_ip_tcp_packet + 6U);
+    ASSERT_EQ(src_mac_view.get<5>(), 0x5EU);
+
+    ldl::object_deserializer<const uint8_t, std::endian::little> little_deserializer{std::span{eth_ip_tcp_packet}};
+    ASSERT_EQ(little_deserializer.view<eth_header_composed>().get<2>(), 0x0008U);
+}
+
+TEST(RecordViewTest, Exceptions) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}.first<19U>()};
+    const auto check_throw{[&deserializer] { (void) deserializer.view<ip_header>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 19U);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ranges>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/records.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    using ip_records = ldl::records_view<ip_header, std::endian::big, const uint8_t>;
+
+    static_assert(std::ranges::random_access_range<ip_records>);
+    static_assert(std::ranges::sized_range<ip_records>);
+    static_assert(std::ranges::view<ip_records>);
+    static_assert(std::ranges::borrowed_range<ip_records>);
+
+    // Five IPv4 headers, with identifications 0 to 4, followed by an incomplete one
+    std::vector<uint8_t> make_headers (void)
+    {
+        std::vector<uint8_t> bytes;
+        for (uint8_t i{0U}; i < 5U; ++i) {
+            bytes.insert (bytes.end(), std::begin (eth_ip_tcp_packet) + 14, std::begin (eth_ip_tcp_packet) + 34);
+            bytes[bytes.size() - 16U] = 0x00U;
+            bytes[bytes.size() - 15U] = i;
+        }
+        bytes.insert (bytes.end(), 7U, 0x00U);
+
+        return bytes;
+    }
+}
+
+TEST(RecordsRangeTest, Iteration) {
+
+    const auto bytes{make_headers()};
+    const auto headers{ldl::records<ip_header, std::endian::big> (std::span{bytes})};
+    ASSERT_EQ(headers.size(), 5U);
+    ASSERT_FALSE(headers.empty());
+
+    uint16_t expected{0U};
+    for (const auto header : headers) {
+        ASSERT_EQ(header.identification, expected++);
+        ASSERT_EQ(header.ttl, 64U);
+    }
+    ASSERT_EQ(expected, 5U);
+}
+
+TEST(RecordsRangeTest, RandomAccess) {
+
+    const auto bytes{make_headers()};
+    const auto headers{ldl::records<ip_header, std::endian::big> (std::span{bytes})};
+    ASSERT_EQ(headers[3].identification, 3U);
+    ASSERT_EQ(headers.back().identification, 4U);
+    ASSERT_EQ(headers.begin()[2].identification, 2U);
+    ASSERT_EQ((*(headers.end() - 1)).identification, 4U);
+    ASSERT_EQ(headers.end() - headers.begin(), 5);
+
+    auto odd{headers | std::views::reverse | std::views::filter ([] (const ip_header & header) { return (header.identification % 2U) == 1U; })};
+    std::vector<uint16_t> identifications;
+    std::ranges::transform (odd, std::back_inserter (identifications), &ip_header::identification);
+    ASSERT_EQ(identifications, (std::vector<uint16_t>{3U, 1U}));
+
+    const auto found{std::ranges::find (headers, uint16_t{2U}, &ip_header::identification)};
+    ASSERT_EQ(found - headers.begin(), 2);
+    ASSERT_EQ(std::ranges::count_if (headers | std::views::drop (1), [] (const ip_header & header) { return header.protocol == 6U; }), 4);
+}
+
+TEST(RecordsRangeTest, Empty) {
+
+    const auto bytes{make_headers()};
+    const auto headers{ldl::records<ip_header, std::endian::big> (std::span{bytes}.first (19U))};
+    ASSERT_TRUE(headers.empty());
+    ASSERT_EQ(headers.begin(), headers.end());
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory_resource>
+#include <variant>
+#include <vector>
+
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+// An entry of a routing update
+struct route_entry
+{
+    uint32_t prefix;
+    uint8_t  prefix_length;
+    uint32_t next_hop;
+    uint16_t metric;
+};
+
+// A routing update: the number of entries, the entries, and a trailer that follows them
+struct route_update
+{
+    uint8_t  version;
+    uint16_t count;
+    std::pmr::vector<route_entry> entries;
+    uint16_t checksum;
+};
+
+// A list of 32-bit identifiers preceded by their count
+struct id_list
+{
+    uint8_t count;
+    std::pmr::vector<uint32_t> ids;
+};
+
+// A routing update nested in a message, followed by an optional list of identifiers
+struct routing_message
+{
+    uint8_t      kind;
+    route_update update;
+    std::variant<std::monostate, id_list> extension;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<route_entry>
+    {
+        using type = std::tuple<uint32_t, uint8_t, uint32_t, uint16_t>;
+    };
+
+    template<> struct rule<route_update>
+    {
+        using type = std::tuple<uint8_t, uint16_t, repeated<1U, route_entry>, uint16_t>;
+    };
+
+    template<> struct rule<id_list>
+    {
+        using type = std::tuple<uint8_t, repeated<0U, uint32_t>>;
+    };
+
+    template<> struct rule<routing_message>
+    {
+        using type = std::tuple<uint8_t, route_update, variant_on<0U, on<1U, id_list>>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t update[] = {
+        0x02, 0x00, 0x03,                                                       // Version, count (3)
+        0x0A, 0x00, 0x00, 0x00, 0x08, 0xC0, 0xA8, 0x01, 0x01, 0x00, 0x0A,       // 10.0.0.0/8 via 192.168.1.1, metric 10
+        0xAC, 0x10, 0x00, 0x00, 0x0C, 0xC0, 0xA8, 0x01, 0x02, 0x00, 0x14,       // 172.16.0.0/12 via 192.168.1.2, metric 20
+        0xC0, 0xA8, 0x00, 0x00, 0x10, 0xC0, 0xA8, 0x01, 0x03, 0x00, 0x1E,       // 192.168.0.0/16 via 192.168.1.3, metric 30
+        0xBE, 0xEF,                                                             // Checksum
+        0xFF
+    };
+
+    // Counts the allocations that it forwards to the default memory resource
+    class counting_resource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations{0U};
+        size_t bytes{0U};
+
+    private:
+        void * do_allocate (size_t size, size_t alignment) override
+        {
+            ++allocations;
+            bytes += size;
+            return std::pmr::get_default_resource()->allocate (size, alignment);
+        }
+        void do_deallocate (void * p, size_t size, size_t alignment) override { std::pmr::get_default_resource()->deallocate (p, size, alignment); }
+        bool do_is_equal (const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+    };
+}
+
+// The minimum length counts the fixed-size elements only
+TEST(RepeatedRecordsTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<route_update>() == 5U);
+    static_assert(!ldl::concepts::fixed_length<route_update>);
+
+    ASSERT_EQ((ldl::deserialization_length_at<route_update, std::endian::big> (update, sizeof(update))), 38U);
+    ASSERT_EQ((ldl::deserialization_length_at<route_update, std::endian::big> (update, 37U)), std::numeric_limits<size_t>::max());
+}
+
+TEST(RepeatedRecordsTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{update}};
+    const auto routes = deserializer.deserialize<route_update>();
+    ASSERT_EQ(routes.version, 2U);
+    ASSERT_EQ(routes.entries.size(), 3U);
+    ASSERT_EQ(format_ip_address (routes.entries[1].prefix), "172.16.0.0");
+    ASSERT_EQ(routes.entries[1].prefix_length, 12U);
+    ASSERT_EQ(format_ip_address (routes.entries[2].next_hop), "192.168.1.3");
+    ASSERT_EQ(routes.entries[2].metric, 30U);
+    ASSERT_EQ(routes.checksum, 0xBEEFU);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 1U);
+
+    const uint8_t ids[] = {0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00};
+    ldl::object_deserializer<const uint8_t, std::endian::little> little_deserializer{std::span{ids}};
+    const auto list = little_deserializer.deserialize<id_list>();
+    ASSERT_EQ(list.ids, (std::pmr::vector<uint32_t>{1U, 2U}));
+}
+
+// The capacity is allocated once, from the memory resource passed in
+TEST(RepeatedRecordsTest, MemoryResource) {
+
+    counting_resource resource;
+    ldl::network_packet_deserializer deserializer{std::span{update}};
+    const auto routes = deserializer.deserialize<route_update> (resource);
+    ASSERT_EQ(resource.allocations, 1U);
+    ASSERT_EQ(resource.bytes, 3U * sizeof(route_entry));
+    ASSERT_EQ(routes.entries.get_allocator().resource(), &resource);
+
+    // The resource is only used during the call
+    ldl::network_packet_deserializer other{std::span{update}};
+    ASSERT_EQ(other.deserialize<route_update>().entries.get_allocator().resource(), std::pmr::get_default_resource());
+    ASSERT_EQ(resource.allocations, 1U);
+
+    // Messages decoded from a monotonic arena, released once per batch
+    std::array<std::byte, 1024U> arena_buffer;
+    std::pmr::monotonic_buffer_resource arena{arena_buffer.data(), arena_buffer.size(), std::pmr::null_memory_resource()};
+    for (size_t i{0U}; i < 4U; ++i) {
+        ldl::network_packet_deserializer message{std::span{update}};
+        ASSERT_EQ(message.deserialize<route_update> (arena).entries[0].metric, 10U);
+    }
+
+    // Empty runs allocate nothing
+    const uint8_t empty[] = {0x02, 0x00, 0x00, 0xBE, 0xEF};
+    ldl::network_packet_deserializer empty_deserializer{std::span{empty}};
+    ASSERT_TRUE(empty_deserializer.deserialize<route_update> (resource).entries.empty());
+    ASSERT_EQ(resource.allocations, 1U);
+
+    ldl::network_packet_deserializer try_deserializer{std::span{update}};
+    const auto tried = try_deserializer.try_deserialize<route_update> (resource);
+    ASSERT_EQ(tried->entries.get_allocator().resource(), &resource);
+    ASSERT_EQ(resource.allocations, 2U);
+}
+
+// The resource reaches the repeated elements of nested objects and of variant_on alternatives
+TEST(RepeatedRecordsTest, NestedMemoryResource) {
+
+    std::vector<uint8_t> message{0x01};
+    message.insert (message.end(), std::begin (update), std::end (update) - 1);
+    message.insert (message.end(), {0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02});
+
+    counting_resource resource;
+    ldl::network_packet_deserializer deserializer{std::span{message}};
+    const auto decoded = deserializer.deserialize<routing_message> (resource);
+    ASSERT_EQ(decoded.update.entries.size(), 3U);
+    ASSERT_EQ(decoded.update.entries.get_allocator().resource(), &resource);
+    ASSERT_EQ(std::get<id_list> (decoded.extension).ids, (std::pmr::vector<uint32_t>{1U, 2U}));
+    ASSERT_EQ(std::get<id_list> (decoded.extension).ids.get_allocator().resource(), &resource);
+    ASSERT_EQ(resource.allocations, 2U);
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+
+    ldl::network_packet_deserializer try_deserializer{std::span{message}};
+    ASSERT_EQ(try_deserializer.try_deserialize<routing_message> (resource)->update.checksum, 0xBEEFU);
+    ASSERT_EQ(resource.allocations, 4U);
+}
+
+TEST(RepeatedRecordsTest, Exceptions) {
+
+    ldl::network_packet_deserializer truncated{std::span{update}.first (37U)};
+    ASSERT_THROW(truncated.deserialize<route_update>(), std::length_error);
+    ASSERT_EQ(truncated.try_deserialize<route_update>().error(), ldl::error::not_enough_bytes);
+
+    // Counts whose product with the record length does not fit in the buffer are rejected without allocating
+    counting_resource resource;
+    const uint8_t huge[] = {0x02, 0xFF, 0xFF, 0x00, 0x00};
+    ldl::network_packet_deserializer deserializer{std::span{huge}};
+    ASSERT_THROW(deserializer.deserialize<route_update> (resource), std::length_error);
+    ASSERT_EQ(resource.allocations, 0U);
+}
+
+// The non-throwing entry points may only throw std::bad_alloc, and are noexcept for types without repeated elements
+TEST(RepeatedRecordsTest, AllocationFailure) {
+
+    static_assert(!noexcept(std::declval<ldl::network_packet_deserializer<const uint8_t> &>().try_deserialize<route_update>()));
+    static_assert(!noexcept(std::declval<ldl::network_packet_deserializer<const uint8_t> &>().try_deserialize<route_update> (std::declval<std::pmr::memory_resource &>())));
+    static_assert(!noexcept(std::declval<ldl::network_packet_deserializer<const uint8_t> &>().deserialize_noexcept<route_update>()));
+    static_assert(noexcept(std::declval<ldl::network_packet_deserializer<const uint8_t> &>().try_deserialize<route_entry>()));
+    static_assert(noexcept(std::declval<ldl::network_packet_deserializer<const uint8_t> &>().deserialize_noexcept<route_entry>()));
+
+    ldl::network_packet_deserializer deserializer{std::span{update}};
+    ASSERT_THROW(static_cast<void> (deserializer.try_deserialize<route_update> (*std::pmr::null_memory_resource())), std::bad_alloc);
+}
@@ -0,0 +1,307 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_serializer.hpp"
+
+
+struct eth_ip_tcp_headers
+{
+    eth_header eth;
+    ip_header ip;
+    tcp_header tcp;
+};
+
+// IPv4 header whose packed fields are split into separate members
+struct ip_header_unpacked
+{
+    uint8_t  version;
+    uint8_t  ihl;
+    uint8_t  dscp;
+    uint8_t  ecn;
+    uint16_t total_length;
+    uint16_t identification;
+    uint8_t  flags;
+    uint16_t frag_offset;
+    uint8_t  ttl;
+    uint8_t  protocol;
+    uint16_t checksum;
+    uint32_t src_ip;
+    uint32_t dest_ip;
+};
+
+// The TTL and the source address of an IPv4 header
+struct ip_source
+{
+    uint8_t  ttl;
+    uint32_t src_ip;
+};
+
+// A record with an array of multi-byte integers, written in little endian
+struct sample
+{
+    uint16_t channel;
+    std::array<uint32_t, 3U> values;
+    int8_t gain;
+};
+
+// Eight 12-bit samples, between a channel number and a checksum
+struct sensor_frame
+{
+    uint8_t                  channel;
+    std::array<uint16_t, 8U> samples;
+    uint16_t                 checksum;
+};
+
+// Three 10-bit readings, as packed by a little endian device, followed by two bits of padding
+struct adc_readings
+{
+    std::array<uint16_t, 3U> readings;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<sensor_frame>
+    {
+        using type = std::tuple<uint8_t, packed_array<12U, 8U>, uint16_t>;
+    };
+
+    template<> struct rule<adc_readings>
+    {
+        using type = std::tuple<packed_array<10U, 3U>>;
+    };
+
+    template<> struct rule<mac>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t>;
+    };
+
+    template<> struct rule<eth_header_composed>
+    {
+        using type = std::tuple<mac, mac, uint16_t>;
+    };
+
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<eth_ip_tcp_headers>
+    {
+        using type = std::tuple<eth_header, ip_header, tcp_header>;
+    };
+
+    template<> struct rule<ip_header_unpacked>
+    {
+        using type = std::tuple<bits<uint8_t, 4U, 4U>, bits<uint8_t, 6U, 2U>, uint16_t, uint16_t, bits<uint16_t, 3U, 13U>,
+                                uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<ip_source>
+    {
+        using type = std::tuple<ignore<std::array<uint16_t, 4U>>, uint8_t, skip<3U>, uint32_t, ignore<uint32_t>>;
+    };
+
+    template<> struct rule<sample>
+    {
+        using type = std::tuple<uint16_t, std::array<uint32_t, 3U>, int8_t>;
+    };
+}
+
+// The constructor of mac takes the bytes of the address, which are not separate members
+template<> struct little_deserialization_library::serialization_rules::fields<mac>
+{
+    static auto get (const mac & value) noexcept
+    {
+        const auto & a{value.address};
+        return std::tie (a[0], a[1], a[2], a[3], a[4], a[5]);
+    }
+};
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+// Objects read from a packet are written back to the same bytes
+TEST(RoundTripSerializationTest, HeaderStack) {
+
+    const auto headers{ldl::deserialize_at<eth_ip_tcp_headers, std::endian::big> (eth_ip_tcp_packet)};
+
+    std::array<uint8_t, ldl::deserialization_length<eth_ip_tcp_headers>()> bytes{};
+    ldl::network_packet_serializer serializer{std::span{bytes}};
+    serializer.serialize (headers);
+    ASSERT_TRUE(serializer.get_unwritten_buffer().empty());
+    ASSERT_TRUE(std::equal (bytes.begin(), bytes.end(), std::begin (eth_ip_tcp_packet)));
+
+    const auto copy{ldl::deserialize_at<eth_ip_tcp_headers, std::endian::big> (bytes.data())};
+    ASSERT_EQ(format_ip_address (copy.ip.dest_ip), "192.168.1.1");
+    ASSERT_EQ(copy.tcp.window_size, headers.tcp.window_size);
+}
+
+// Types that are not aggregates are written through a specialization of serialization_rules::fields
+TEST(RoundTripSerializationTest, ComposedRules) {
+
+    const eth_header_composed eth{mac{0x00, 0x11, 0x22, 0x33, 0x44, 0x55}, mac{0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E}, 0x0800U};
+
+    std::array<uint8_t, 14U> bytes{};
+    ldl::network_packet_serializer serializer{std::span{bytes}};
+    serializer.serialize (eth);
+    ASSERT_TRUE(std::equal (bytes.begin(), bytes.end(), std::begin (eth_ip_tcp_packet)));
+}
+
+// The fields of a word are packed back into it
+TEST(RoundTripSerializationTest, BitFields) {
+
+    const auto ip{ldl::deserialize_at<ip_header_unpacked, std::endian::big> (eth_ip_opt_tcp_seg_packet + 14U)};
+
+    std::array<uint8_t, 20U> bytes{};
+    ldl::network_packet_serializer serializer{std::span{bytes}};
+    serializer.serialize (ip);
+    ASSERT_TRUE(std::equal (bytes.begin(), bytes.end(), std::begin (eth_ip_opt_tcp_seg_packet) + 14));
+
+    // Values wider than their field are truncated to its width
+    auto bits{ldl::bits<uint16_t, 3U, 13U>{0U}};
+    bits.set<0> (0xFU);
+    bits.set<1> (0x1234U);
+    ASSERT_EQ(bits.word, 0xF234U);
+    bits.set<1> (0U);
+    ASSERT_EQ(bits.get<0>(), 0x7U);
+    ASSERT_EQ(bits.get<1>(), 0U);
+}
+
+// Values are packed back to back, and the padding bits of the last byte are left as they are
+TEST(RoundTripSerializationTest, PackedArrays) {
+
+    const uint8_t frame[] = {
+        0x07,                                   // Channel
+        0x00, 0x10, 0x02, 0x80, 0x0F, 0xFF,     // Samples: 0x001, 0x002, 0x800, 0xFFF
+        0x12, 0x34, 0x56, 0xAB, 0xCD, 0xEF,     // Samples: 0x123, 0x456, 0xABC, 0xDEF
+        0xBE, 0xEF                              // Checksum
+    };
+    const auto samples{ldl::deserialize_at<sensor_frame, std::endian::big> (frame)};
+
+    std::array<uint8_t, 15U> bytes{};
+    ldl::network_packet_serializer serializer{std::span{bytes}};
+    serializer.serialize (samples);
+    ASSERT_TRUE(std::equal (std::begin (frame), std::end (frame), bytes.begin()));
+
+    // 0x155, 0x2AA and 0x3FF, then padding bits 10
+    std::array<uint8_t, 4U> readings_bytes{0x00, 0x00, 0x00, 0x80};
+    ldl::object_serializer<uint8_t, std::endian::little> readings_serializer{std::span{readings_bytes}};
+    readings_serializer.serialize (adc_readings{{0x155U, 0x2AAU, 0x3FFU}});
+    ASSERT_EQ(readings_bytes, (std::array<uint8_t, 4U>{0x55, 0xA9, 0xFA, 0xBF}));
+
+    const auto readings{ldl::deserialize_at<adc_readings, std::endian::little> (readings_bytes.data())};
+    ASSERT_EQ(readings.readings, (std::array<uint16_t, 3U>{0x155U, 0x2AAU, 0x3FFU}));
+
+    // Every width, packed and unpacked in both endiannesses, including values wider than their field
+    [] <size_t... Widths> (std::index_sequence<Widths...>) {
+        ([] {
+            constexpr auto bits{Widths + 1U};
+            std::array<uint32_t, 11U> values{};
+            for (size_t i{0U}; i < values.size(); ++i) {
+                values[i] = (0x9E3779B9U * static_cast<uint32_t> (i + 1U)) >> (32U - bits);
+            }
+            values[0] |= (bits < 32U) ? (uint32_t{1U} << bits) : 0U;
+
+            std::array<uint8_t, 44U> packed{};
+            std::array<uint32_t, 11U> unpacked{};
+            ldl::bit_unpacker::pack<bits, std::endian::big> (values.data(), packed.data(), values.size());
+            ldl::bit_unpacker::unpack<bits, std::endian::big> (packed.data(), unpacked.data(), unpacked.size());
+            values[0] &= static_cast<uint32_t> ((uint64_t{1U} << bits) - 1U);
+            ASSERT_EQ(unpacked, values) << bits << " bits, big endian";
+
+            ldl::bit_unpacker::pack<bits, std::endian::little> (values.data(), packed.data(), values.size());
+            ldl::bit_unpacker::unpack<bits, std::endian::little> (packed.data(), unpacked.data(), unpacked.size());
+            ASSERT_EQ(unpacked, values) << bits << " bits, little endian";
+        } (), ...);
+    } (std::make_index_sequence<32U>());
+}
+
+// Skipped bytes are left as they are, so that a projection is written back in place
+TEST(RoundTripSerializationTest, ProjectionRewrite) {
+
+    std::vector<uint8_t> packet(std::begin (eth_ip_tcp_packet), std::end (eth_ip_tcp_packet));
+    const auto ip_bytes{std::span{packet}.subspan (14U)};
+
+    ldl::network_packet_deserializer deserializer{ip_bytes};
+    auto source{deserializer.deserialize<ip_source>()};
+    source.ttl -= 1U;
+    source.src_ip = 0x0A000001U;
+
+    ldl::network_packet_serializer serializer{ip_bytes};
+    serializer.serialize (source);
+    ASSERT_EQ(serializer.get_unwritten_buffer().size(), ip_bytes.size() - 20U);
+
+    const auto ip{ldl::deserialize_at<ip_header, std::endian::big> (ip_bytes.data())};
+    ASSERT_EQ(ip.ttl, eth_ip_tcp_packet[22] - 1U);
+    ASSERT_EQ(format_ip_address (ip.src_ip), "10.0.0.1");
+    ASSERT_EQ(format_ip_address (ip.dest_ip), "192.168.1.1");
+    for (const size_t i : {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 9U, 10U, 11U}) {
+        ASSERT_EQ(ip_bytes[i], eth_ip_tcp_packet[14U + i]);
+    }
+}
+
+TEST(RoundTripSerializationTest, LittleEndian) {
+
+    const sample value{0x0102U, {0x03040506U, 0x0708090AU, 0xDEADBEEFU}, -2};
+
+    std::array<uint8_t, 15U> bytes{};
+    ldl::object_serializer<uint8_t, std::endian::little> serializer{std::span{bytes}};
+    serializer.serialize (value);
+
+    const std::array<uint8_t, 15U> expected{0x02, 0x01, 0x06, 0x05, 0x04, 0x03, 0x0A, 0x09, 0x08, 0x07, 0xEF, 0xBE, 0xAD, 0xDE, 0xFE};
+    ASSERT_EQ(bytes, expected);
+
+    const auto copy{ldl::deserialize_at<sample, std::endian::little> (bytes.data())};
+    ASSERT_EQ(copy.channel, value.channel);
+    ASSERT_EQ(copy.values, value.values);
+    ASSERT_EQ(copy.gain, value.gain);
+}
+
+// Arithmetic values are written in constant evaluation too
+TEST(RoundTripSerializationTest, ConstantEvaluation) {
+
+    constexpr auto bytes{[] {
+        std::array<uint8_t, 10U> bytes{};
+        ldl::writer::write<uint32_t> (bytes.data(), 0x01020304U);
+        ldl::writer::write<int16_t, std::endian::little> (bytes.data() + 4U, int16_t{-2});
+        ldl::writer::write<float> (bytes.data() + 6U, 1.0f);
+        return bytes;
+    } ()};
+
+    static_assert(bytes == std::array<uint8_t, 10U>{0x01, 0x02, 0x03, 0x04, 0xFE, 0xFF, 0x3F, 0x80, 0x00, 0x00});
+    static_assert(ldl::reader::read<float> (bytes.data() + 6U) == 1.0f);
+}
+
+TEST(RoundTripSerializationTest, Exceptions) {
+
+    const ip_header ip{0x45U, 0U, 20U, 1U, 0U, 64U, 6U, 0U, 0x0A000001U, 0x0A000002U};
+
+    std::array<uint8_t, 30U> bytes{};
+    ldl::network_packet_serializer serializer{std::span{bytes}};
+    serializer.serialize (ip);
+    ASSERT_THROW(serializer.serialize (ip), std::length_error);
+    ASSERT_EQ(serializer.try_serialize (ip).error(), ldl::error::not_enough_bytes);
+    ASSERT_EQ(serializer.get_unwritten_buffer().size(), 10U);
+    ASSERT_TRUE(serializer.try_serialize (uint64_t{0x0102030405060708U}).has_value());
+    ASSERT_EQ(bytes[20], 0x01U);
+    ASSERT_THROW(serializer.skip (3U), std::length_error);
+}
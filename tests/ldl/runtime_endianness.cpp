@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/runtime_endian_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<eth_header>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t>;
+    };
+
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    // The values 0x01020304 and 0x0506, in little endian
+    const uint8_t little_endian_values[] = {0x04, 0x03, 0x02, 0x01, 0x06, 0x05};
+}
+
+TEST(RuntimeEndiannessTest, FieldsExtraction) {
+
+    ldl::runtime_endian_deserializer deserializer{std::span{eth_ip_tcp_packet}, std::endian::big};
+    ASSERT_EQ(deserializer.endianness(), std::endian::big);
+    const auto [ether_frame, ip_packet] = deserializer.deserialize<eth_header, ip_header>();
+    ASSERT_EQ(ether_frame.ethertype, 0x0800U);
+    ASSERT_EQ(ip_packet.identification, 6699U);
+    ASSERT_EQ(format_ip_address (ip_packet.src_ip), "192.168.1.100");
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), sizeof(eth_ip_tcp_packet) - 34U);
+
+    ldl::runtime_endian_deserializer little{std::span{little_endian_values}, std::endian::little};
+    ASSERT_EQ(little.endianness(), std::endian::little);
+    ASSERT_EQ(little.deserialize<uint32_t>(), 0x01020304U);
+    ASSERT_EQ(little.deserialize_noexcept<uint16_t>(), 0x0506U);
+
+    ldl::runtime_endian_deserializer big{std::span{little_endian_values}, std::endian::big};
+    ASSERT_EQ(big.deserialize<uint32_t>(), 0x04030201U);
+    ASSERT_EQ(big.deserialize<uint16_t>(), 0x0605U);
+}
+
+// The visitor is compiled for both endiannesses, and called with the one selected at construction
+TEST(RuntimeEndiannessTest, Visit) {
+
+    for (const auto endianness : {std::endian::big, std::endian::little}) {
+        ldl::runtime_endian_deserializer deserializer{std::span{little_endian_values}.first (4U), endianness};
+        std::vector<uint16_t> values;
+        const auto selected = deserializer.visit ([&values] <std::endian E> (ldl::object_deserializer<const uint8_t, E> & inner) {
+            inner.template deserialize_n<uint16_t> (2U, std::back_inserter (values));
+            return E;
+        });
+        ASSERT_EQ(selected, endianness);
+        ASSERT_EQ(values, (endianness == std::endian::big) ? (std::vector<uint16_t>{0x0403U, 0x0201U}) : (std::vector<uint16_t>{0x0304U, 0x0102U}));
+    }
+}
+
+TEST(RuntimeEndiannessTest, Exceptions) {
+
+    ldl::runtime_endian_deserializer deserializer{std::span{little_endian_values}, std::endian::little};
+    deserializer.skip<uint16_t>();
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<uint64_t>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_FALSE(deserializer.try_deserialize<uint64_t>().has_value());
+    ASSERT_FALSE(deserializer.try_skip (5U).has_value());
+    ASSERT_THROW(deserializer.skip (5U), std::length_error);
+    ASSERT_EQ(*deserializer.try_deserialize<uint32_t>(), 0x05060102U);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/tlv_range.hpp"
+
+
+// The values of the TCP options that are decoded
+struct mss_option
+{
+    uint16_t mss;
+};
+
+struct window_scale_option
+{
+    uint8_t shift;
+};
+
+struct timestamps_option
+{
+    uint32_t value;
+    uint32_t echo_reply;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+
+    template<> struct rule<mss_option>
+    {
+        using type = std::tuple<uint16_t>;
+    };
+
+    template<> struct rule<window_scale_option>
+    {
+        using type = std::tuple<uint8_t>;
+    };
+
+    template<> struct rule<timestamps_option>
+    {
+        using type = std::tuple<uint32_t, uint32_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t tcp_syn[] = {
+        0x30, 0x39, 0x00, 0x50,                                             // Source Port: 12345, Destination Port: 80
+        0x12, 0x34, 0x56, 0x78,                                             // Sequence Number
+        0x00, 0x00, 0x00, 0x00,                                             // Acknowledgment Number
+        0xA0, 0x02, 0xFA, 0xF0,                                             // Data Offset (10), Flags (SYN), Window Size
+        0x00, 0x00, 0x00, 0x00,                                             // Checksum, Urgent Pointer
+        0x02, 0x04, 0x05, 0xB4,                                             // Maximum Segment Size: 1460
+        0x04, 0x02,                                                         // SACK Permitted
+        0x08, 0x0A, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00,         // Timestamps
+        0x01,                                                               // No-Operation
+        0x03, 0x03, 0x07,                                                   // Window Scale: 7
+    };
+
+    using tcp_options = ldl::tlv_range<uint8_t, uint8_t, std::endian::big, const uint8_t, ldl::tlv_layouts::tcp_options>;
+}
+
+// The options that follow a TCP header, in the unread part of the buffer
+TEST(TlvOptionsTest, TcpOptions) {
+
+    ldl::network_packet_deserializer deserializer{std::span{tcp_syn}};
+    const auto tcp = deserializer.deserialize<tcp_header>();
+    const tcp_options options{deserializer.get_unread_buffer ((tcp.data_offset_rsvd >> 4U) * 4U - 20U)};
+    ASSERT_TRUE(options.well_formed());
+
+    std::vector<uint8_t> types;
+    for (const auto & option : options) {
+        types.push_back (option.type);
+    }
+    ASSERT_EQ(types, (std::vector<uint8_t>{2U, 4U, 8U, 1U, 3U}));
+
+    // Values are views into the buffer
+    const auto timestamps{options.find (8U)};
+    ASSERT_TRUE(timestamps.has_value());
+    ASSERT_EQ(timestamps->value.data(), tcp_syn + 28U);
+    ASSERT_EQ(timestamps->value.size(), 8U);
+    ASSERT_TRUE(options.find (1U)->value.empty());
+    ASSERT_FALSE(options.find (5U).has_value());
+}
+
+// Known types are decoded through their rules, and unknown ones are not read
+TEST(TlvOptionsTest, Decoding) {
+
+    const tcp_options options{std::span{tcp_syn}.subspan (20U)};
+
+    uint16_t mss{0U};
+    uint8_t shift{0U};
+    uint32_t timestamp{0U};
+    size_t unknown{0U};
+    for (const auto & option : options) {
+        const auto decoded{option.decode<ldl::on<2, mss_option>, ldl::on<3, window_scale_option>, ldl::on<8, timestamps_option>>()};
+        std::visit ([&] (const auto & value) {
+            using V = std::remove_cvref_t<decltype(value)>;
+            if constexpr (std::is_same_v<V, mss_option>) { mss = value.mss; }
+            else if constexpr (std::is_same_v<V, window_scale_option>) { shift = value.shift; }
+            else if constexpr (std::is_same_v<V, timestamps_option>) { timestamp = value.value; }
+            else { ++unknown; }
+        }, decoded);
+    }
+    ASSERT_EQ(mss, 1460U);
+    ASSERT_EQ(shift, 7U);
+    ASSERT_EQ(timestamp, 0x00010203U);
+    ASSERT_EQ(unknown, 2U);
+
+    // Values shorter than the rule of their type are not decoded
+    const uint8_t short_mss[] = {0x02, 0x03, 0x05};
+    const auto option{*tcp_options{std::span{short_mss}}.begin()};
+    ASSERT_TRUE(std::holds_alternative<std::monostate> (option.decode<ldl::on<2, mss_option>>()));
+}
+
+// Iteration stops at the end of the option list, and at invalid lengths
+TEST(TlvOptionsTest, BoundsChecks) {
+
+    const uint8_t terminated[] = {0x02, 0x04, 0x05, 0xB4, 0x00, 0x00, 0x00, 0x00};
+    const tcp_options padded{std::span{terminated}};
+    ASSERT_EQ(std::ranges::distance (padded), 1);
+    ASSERT_TRUE(padded.well_formed());
+
+    // The security option of the IPv4 header has a length of 0, shorter than its own header
+    const auto ip_options{ldl::tlv<uint8_t, uint8_t, std::endian::big, ldl::tlv_layouts::ipv4_options> (std::span{eth_ip_opt_tcp_seg_packet}.subspan (34U, 4U))};
+    ASSERT_EQ(std::ranges::distance (ip_options), 2);
+    ASSERT_FALSE(ip_options.well_formed());
+
+    // The length exceeds the buffer
+    const uint8_t truncated[] = {0x01, 0x08, 0x0A, 0x00, 0x01};
+    const tcp_options options{std::span{truncated}};
+    ASSERT_EQ(std::ranges::distance (options), 1);
+    ASSERT_FALSE(options.well_formed());
+    ASSERT_FALSE(tcp_options{std::span{truncated}.first (1U)}.find (8U).has_value());
+}
+
+// DHCP options, whose length excludes the header, and a protocol with 16-bit little-endian fields
+TEST(TlvOptionsTest, Layouts) {
+
+    const uint8_t dhcp[] = {0x35, 0x01, 0x05, 0x00, 0x00, 0x33, 0x04, 0x00, 0x01, 0x51, 0x80, 0xFF, 0x00};
+    const auto options{ldl::tlv<uint8_t, uint8_t, std::endian::big, ldl::tlv_layouts::dhcp_options> (std::span{dhcp})};
+    ASSERT_EQ(std::ranges::distance (options), 4);
+    ASSERT_TRUE(options.well_formed());
+    ASSERT_EQ(options.find (0x35U)->value[0], 0x05U);
+    ASSERT_EQ(std::get<1>(options.find (0x33U)->decode<ldl::on<0x33, uint32_t>>()), 86400U);
+
+    const uint8_t records[] = {0x01, 0x00, 0x02, 0x00, 0xAA, 0xBB, 0x02, 0x01, 0x00, 0x00};
+    const auto fields{ldl::tlv<uint16_t, uint16_t, std::endian::little> (std::span{records})};
+    ASSERT_TRUE(fields.well_formed());
+    ASSERT_EQ(fields.find (0x0102U)->value.size(), 0U);
+    ASSERT_EQ(fields.find (1U)->value[1], 0xBBU);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<tcp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint32_t, uint32_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+}
+
+// Complete headers are deserialized as with deserialize
+TEST(TryDeserializeTest, CompletePacket) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    ASSERT_TRUE(deserializer.try_skip (14U));
+    const auto ip_packet{deserializer.try_deserialize<ip_header>()};
+    ASSERT_TRUE(ip_packet.has_value());
+    ASSERT_EQ(ip_packet->identification, 6699U);
+    ASSERT_EQ(ip_packet->src_ip, 0xC0A80164U);
+
+    const auto tcp_packet{deserializer.try_deserialize<tcp_header>()};
+    ASSERT_TRUE(tcp_packet);
+    ASSERT_EQ((*tcp_packet).seq_number, 305419896U);
+    ASSERT_EQ(tcp_packet.value().window_size, 0x7110U);
+    ASSERT_TRUE(deserializer.get_unread_buffer().empty());
+}
+
+// Truncated packets report an error and leave the buffer unchanged
+TEST(TryDeserializeTest, TruncatedPacket) {
+
+    const auto truncated{std::span{eth_ip_tcp_packet}.first<44U>()};
+    ldl::network_packet_deserializer deserializer{truncated};
+    ASSERT_TRUE(deserializer.try_skip<ip_header>());
+    ASSERT_TRUE(deserializer.try_skip<uint8_t[14]>());
+
+    const auto tcp_packet{deserializer.try_deserialize<tcp_header>()};
+    ASSERT_FALSE(tcp_packet.has_value());
+    ASSERT_EQ(tcp_packet.error(), ldl::error::not_enough_bytes);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 10U);
+
+    const auto skipped{deserializer.try_skip (11U)};
+    ASSERT_FALSE(skipped);
+    ASSERT_EQ(skipped.error(), ldl::error::not_enough_bytes);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 10U);
+
+    ASSERT_TRUE(deserializer.try_skip (10U));
+    ASSERT_EQ(deserializer.try_deserialize<uint8_t>().error(), ldl::error::not_enough_bytes);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <variant>
+
+#include "helpers/network_headers.hpp"
+#include "helpers/network_packets.hpp"
+#include "helpers/utilities.hpp"
+
+#include "ldl/object_deserializer.hpp"
+
+
+namespace ldl = little_deserialization_library;
+
+using l3_header = ldl::variant_of<ldl::on<0x0800, ip_header>, ldl::on<0x86DD, ipv6_header>, ldl::on<0x0806, arp_header>>;
+
+// An Ethernet frame followed by the header selected by its ethertype
+struct eth_frame
+{
+    std::array<uint8_t, 6U> dest_mac;
+    std::array<uint8_t, 6U> src_mac;
+    uint16_t ethertype;
+    l3_header l3;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<ip_header>
+    {
+        using type = std::tuple<uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, uint32_t, uint32_t>;
+    };
+
+    template<> struct rule<ipv6_header>
+    {
+        using type = std::tuple<uint32_t, uint16_t, uint8_t, uint8_t, std::array<uint8_t, 16U>, std::array<uint8_t, 16U>>;
+    };
+
+    template<> struct rule<arp_header>
+    {
+        using type = std::tuple<uint16_t, uint16_t, uint8_t, uint8_t, uint16_t, std::array<uint8_t, 6U>, uint32_t, std::array<uint8_t, 6U>, uint32_t>;
+    };
+
+    template<> struct rule<eth_frame>
+    {
+        using type = std::tuple<std::array<uint8_t, 6U>, std::array<uint8_t, 6U>, uint16_t,
+                                variant_on<2U, on<0x0800, ip_header>, on<0x86DD, ipv6_header>, on<0x0806, arp_header>>>;
+    };
+}
+
+// Every key has its own slot, and other keys are not found
+TEST(VariantDecodingTest, PerfectHash) {
+
+    using hash = ldl::dispatch::perfect_hash<0x0800U, 0x86DDU, 0x0806U, 0x8100U, 0x88CCU>;
+    static_assert(hash::find (0x0800U) == 1U);
+    static_assert(hash::find (0x86DDU) == 2U);
+    static_assert(hash::find (0x88CCU) == 5U);
+    static_assert(hash::find (0x0801U) == 0U);
+    static_assert(hash::find (0U) == 0U);
+    static_assert(ldl::deserialization_length<eth_frame>() == 14U);
+}
+
+// The rule element decodes the header selected by the preceding ethertype
+TEST(VariantDecodingTest, RuleElement) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    const auto frame = deserializer.deserialize<eth_frame>();
+    ASSERT_EQ(frame.ethertype, 0x0800U);
+    ASSERT_TRUE(std::holds_alternative<ip_header>(frame.l3));
+    ASSERT_EQ(format_ip_address (std::get<ip_header> (frame.l3).dest_ip), "192.168.1.1");
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 20U);
+
+    ldl::network_packet_deserializer arp_deserializer{std::span{eth_arp_packet}};
+    const auto arp_frame = arp_deserializer.deserialize<eth_frame>();
+    ASSERT_TRUE(std::holds_alternative<arp_header>(arp_frame.l3));
+    ASSERT_EQ(std::get<arp_header> (arp_frame.l3).operation, 1U);
+    ASSERT_EQ(format_ip_address (std::get<arp_header> (arp_frame.l3).target_ip), "192.168.1.1");
+    ASSERT_TRUE(arp_deserializer.get_unread_buffer().empty());
+}
+
+// Layered decoding: the key comes from a header that was already deserialized
+TEST(VariantDecodingTest, DeserializeOn) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}};
+    deserializer.skip (12U);
+    const auto ethertype = deserializer.deserialize<uint16_t>();
+    const auto l3 = deserializer.deserialize_on<ldl::on<0x86DD, ipv6_header>, ldl::on<0x0800, ip_header>> (ethertype);
+    ASSERT_EQ(l3.index(), 2U);
+    ASSERT_EQ(std::get<ip_header> (l3).protocol, 0x06U);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 20U);
+
+    const auto unknown = deserializer.deserialize_on<ldl::on<17, ipv6_header>> (ethertype);
+    ASSERT_TRUE(std::holds_alternative<std::monostate>(unknown));
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 20U);
+}
+
+// The length of the selected alternative is checked against the buffer
+TEST(VariantDecodingTest, Exceptions) {
+
+    ldl::network_packet_deserializer deserializer{std::span{eth_ip_tcp_packet}.first<33U>()};
+    const auto check_throw{[&deserializer] { (void) deserializer.deserialize<eth_frame>(); }};
+    ASSERT_THROW(check_throw(), std::length_error);
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 33U);
+    ASSERT_FALSE(deserializer.try_deserialize<eth_frame>().has_value());
+
+    ldl::network_packet_deserializer l3_deserializer{std::span{eth_ip_tcp_packet}.subspan<14U>().first<19U>()};
+    const auto check_throw_on{[&l3_deserializer] { (void) l3_deserializer.deserialize_on<ldl::on<0x0800, ip_header>> (0x0800); }};
+    ASSERT_THROW(check_throw_on(), std::length_error);
+}
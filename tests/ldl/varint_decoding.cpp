@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "ldl/object_deserializer.hpp"
+
+
+// A record in the style of Protocol Buffers: an identifier, a signed delta, and a name preceded by its varint length
+struct sample
+{
+    uint8_t          tag;
+    uint64_t         id;
+    int32_t          delta;
+    uint16_t         name_length;
+    std::string_view name;
+};
+
+namespace little_deserialization_library::deserialization_rules
+{
+    template<> struct rule<sample>
+    {
+        using type = std::tuple<uint8_t, varint<uint64_t>, zigzag<int32_t>, varint<uint16_t>, sized_by<3U>>;
+    };
+}
+
+namespace
+{
+    namespace ldl = little_deserialization_library;
+
+    const uint8_t record[] = {
+        0x01,                                   // Tag
+        0x96, 0x01,                             // Identifier: 150
+        0x03,                                   // Delta: -2
+        0x05,                                   // Name length: 5
+        'e', 'i', 'g', 'h', 't',                // Name
+        0xFF
+    };
+
+    void encode (std::vector<uint8_t> & bytes, uint64_t value)
+    {
+        for (; value >= 0x80U; value >>= 7U) {
+            bytes.push_back (static_cast<uint8_t> (value | 0x80U));
+        }
+        bytes.push_back (static_cast<uint8_t> (value));
+    }
+}
+
+// The minimum length counts one byte per varint
+TEST(VarintDecodingTest, DeserializationLength) {
+
+    static_assert(ldl::deserialization_length<sample>() == 4U);
+    static_assert(ldl::deserialization_length<ldl::varint<uint64_t>>() == 1U);
+    static_assert(!ldl::concepts::fixed_length<sample>);
+
+    ASSERT_EQ((ldl::deserialization_length_at<sample, std::endian::big> (record, sizeof(record))), 10U);
+    ASSERT_EQ((ldl::deserialization_length_at<sample, std::endian::big> (record, 9U)), std::numeric_limits<size_t>::max());
+    ASSERT_EQ((ldl::deserialization_length_at<ldl::varint<uint64_t>, std::endian::big> (record + 1U, 1U)), std::numeric_limits<size_t>::max());
+}
+
+TEST(VarintDecodingTest, FieldsExtraction) {
+
+    ldl::network_packet_deserializer deserializer{std::span{record}};
+    const auto decoded = deserializer.deserialize<sample>();
+    ASSERT_EQ(decoded.tag, 1U);
+    ASSERT_EQ(decoded.id, 150U);
+    ASSERT_EQ(decoded.delta, -2);
+    ASSERT_EQ(decoded.name, "eight");
+    ASSERT_EQ(deserializer.get_unread_buffer().size(), 1U);
+
+    // Varints on their own, whatever the endianness of the deserializer
+    const uint8_t values[] = {0xAC, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F};
+    ldl::object_deserializer<const uint8_t, std::endian::little> little_deserializer{std::span{values}};
+    ASSERT_EQ(little_deserializer.deserialize<ldl::varint<uint16_t>>(), 300U);
+    ASSERT_EQ(little_deserializer.deserialize<ldl::zigzag<int64_t>>(), -1);
+    ASSERT_EQ(little_deserializer.deserialize<ldl::varint<uint32_t>>(), std::numeric_limits<uint32_t>::max());
+    ASSERT_EQ(little_deserializer.try_deserialize<ldl::zigzag<int32_t>>().value(), std::numeric_limits<int32_t>::max());
+    ASSERT_TRUE(little_deserializer.get_unread_buffer().empty());
+}
+
+TEST(VarintDecodingTest, Exceptions) {
+
+    // The name is truncated
+    ldl::network_packet_deserializer truncated{std::span{record}.first (9U)};
+    ASSERT_THROW(truncated.deserialize<sample>(), std::length_error);
+    ASSERT_EQ(truncated.try_deserialize<sample>().error(), ldl::error::not_enough_bytes);
+
+    // The last byte has its continuation bit set
+    const uint8_t unterminated[] = {0x80, 0x80};
+    ldl::network_packet_deserializer deserializer{std::span{unterminated}};
+    ASSERT_THROW(deserializer.deserialize<ldl::varint<uint64_t>>(), std::length_error);
+    ASSERT_EQ(deserializer.try_deserialize<ldl::varint<uint64_t>>().error(), ldl::error::not_enough_bytes);
+
+    // A 16-bit value takes at most 3 bytes
+    const uint8_t overlong[] = {0x80, 0x80, 0x80, 0x01};
+    ldl::network_packet_deserializer overlong_deserializer{std::span{overlong}};
+    ASSERT_THROW(overlong_deserializer.deserialize<ldl::varint<uint16_t>>(), std::length_error);
+    ASSERT_EQ(overlong_deserializer.deserialize<ldl::varint<uint32_t>>(), 1U << 21U);
+}
+
+// Runs of one-byte and two-byte varints, and varints of every length, decoded in bulk as one at a time
+TEST(VarintDecodingTest, BulkDecoding) {
+
+    std::mt19937_64 generator{42U};
+    std::vector<uint64_t> values;
+    for (size_t i{0U}; i < 40U; ++i) {
+        values.push_back (generator() & 0x7FU);
+    }
+    for (size_t i{0U}; i < 40U; ++i) {
+        values.push_back ((generator() & 0x3FFFU) | 0x80U);
+    }
+    for (size_t i{0U}; i < 400U; ++i) {
+        values.push_back (generator() >> (generator() % 64U));
+    }
+    values.push_back (std::numeric_limits<uint64_t>::max());
+    values.push_back (0U);
+
+    std::vector<uint8_t> bytes;
+    for (const auto value : values) {
+        encode (bytes, value);
+    }
+
+    std::vector<uint64_t> decoded(values.size() + 1U);
+    const auto result{ldl::decode_varints (std::span{std::as_const (bytes)}, std::span{decoded})};
+    ASSERT_EQ(result.values, values.size());
+    ASSERT_EQ(result.bytes, bytes.size());
+    decoded.pop_back();
+    ASSERT_EQ(decoded, values);
+
+    // Decoding stops when out is full, and at the first truncated varint
+    std::vector<uint64_t> first(17U);
+    ASSERT_EQ(ldl::decode_varints (std::span{bytes}, std::span{first}).bytes, 17U);
+    ASSERT_EQ(first[16U], values[16U]);
+    bytes.back() = 0x80U;
+    ASSERT_EQ(ldl::decode_varints (std::span{bytes}, std::span{decoded}).values, values.size() - 1U);
+
+    // Values wider than the output type are overlong
+    const uint8_t wide[] = {0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x02};
+    std::vector<uint32_t> narrow(3U);
+    ASSERT_EQ(ldl::decode_varints (std::span{wide}, std::span{narrow}).values, 1U);
+}
+
+TEST(VarintDecodingTest, ZigzagDecoding) {
+
+    std::vector<int64_t> values;
+    for (int64_t i{-300}; i <= 300; ++i) {
+        values.push_back (i);
+    }
+    values.push_back (std::numeric_limits<int64_t>::min());
+    values.push_back (std::numeric_limits<int64_t>::max());
+
+    std::vector<uint8_t> bytes;
+    for (const auto value : values) {
+        encode (bytes, (static_cast<uint64_t> (value) << 1U) ^ static_cast<uint64_t> (value >> 63U));
+    }
+
+    std::vector<int64_t> decoded(values.size());
+    const auto result{ldl::decode_zigzag_varints (std::span{bytes}, std::span{decoded})};
+    ASSERT_EQ(result.values, values.size());
+    ASSERT_EQ(result.bytes, bytes.size());
+    ASSERT_EQ(decoded, values);
+}